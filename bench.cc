@@ -0,0 +1,1415 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cmath>
+
+#include "conn.hh"
+
+// Every allocation made by the library goes through these operators, so the
+// harness can report allocations per operation next to the time. All forms
+// are replaced, so each pointer is freed by the pair that allocated it.
+static std::atomic<std::size_t> numberOfAllocations(0);
+
+// Inlined replaced deletes look like free() of operator new memory to GCC.
+#if defined(__GNUC__)
+#define BENCH_NOINLINE __attribute__((noinline))
+#else
+#define BENCH_NOINLINE
+#endif
+
+static void *countedAllocation(const std::size_t size) noexcept{
+    ++numberOfAllocations;
+
+    return std::malloc(0 == size ? 1 : size);
+}
+
+void *operator new(std::size_t size){
+    void *pointer = countedAllocation(size);
+
+    if(nullptr == pointer){
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+void *operator new[](std::size_t size){
+    void *pointer = countedAllocation(size);
+
+    if(nullptr == pointer){
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept{
+    return countedAllocation(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept{
+    return countedAllocation(size);
+}
+
+BENCH_NOINLINE void operator delete(void *pointer) noexcept{
+    std::free(pointer);
+}
+
+BENCH_NOINLINE void operator delete[](void *pointer) noexcept{
+    std::free(pointer);
+}
+
+BENCH_NOINLINE void operator delete(
+    void *pointer,
+    const std::nothrow_t &
+) noexcept{
+    std::free(pointer);
+}
+
+BENCH_NOINLINE void operator delete[](
+    void *pointer,
+    const std::nothrow_t &
+) noexcept{
+    std::free(pointer);
+}
+
+BENCH_NOINLINE void operator delete(void *pointer, std::size_t) noexcept{
+    std::free(pointer);
+}
+
+BENCH_NOINLINE void operator delete[](void *pointer, std::size_t) noexcept{
+    std::free(pointer);
+}
+
+static volatile double sink = 0.;
+
+static const double minimumTime = 0.2;
+
+static std::string filter;
+
+template<typename Function>
+static void measure(
+    const std::string &name,
+    const std::size_t size,
+    const std::size_t operations,
+    const Function &function
+){
+    if(std::string::npos == name.find(filter)){
+        return;
+    }
+
+    function();
+
+    std::size_t repetitions = 1;
+    std::size_t allocations = 0;
+    double elapsed = 0.;
+
+    while(true){
+        const std::size_t initialAllocations = numberOfAllocations;
+        const std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+
+        for(std::size_t i = 0; i < repetitions; ++i){
+            function();
+        }
+
+        elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+        allocations = numberOfAllocations - initialAllocations;
+
+        if(elapsed >= minimumTime){
+            break;
+        }
+
+        repetitions *= 2;
+    }
+
+    const double total = static_cast<double>(repetitions * operations);
+
+    std::printf(
+        "%-44s %8zu %12.2f %12.3f\n",
+        name.c_str(),
+        size,
+        1e9 * elapsed / total,
+        allocations / total
+    );
+}
+
+// Checks run before the measurements, so a wrong result fails the run
+// instead of being timed.
+static bool check(const bool condition, const char *name){
+    if(!condition){
+        std::fprintf(stderr, "check failed: %s\n", name);
+    }
+
+    return condition;
+}
+
+static bool checkGPSPointRoundTrip(const conn::GeoPoint expected){
+    const std::string text = conn::stringFromGPSPoint(
+        conn::gpsPointFromDegrees(expected)
+    );
+    conn::GPSPoint point{};
+    const conn::ParseResult result = conn::parseGPSPoint(
+        text.data(),
+        text.data() + text.size(),
+        point
+    );
+
+    return std::errc() == result.error
+        && fabs(
+            conn::degreesFromGPSCoordinate(point.latitude) - expected.latitude
+        ) < 1. / 3600.
+        && fabs(
+            conn::degreesFromGPSCoordinate(point.longitude)
+                - expected.longitude
+        ) < 1. / 3600.;
+}
+
+static bool checkParseGPSPoint(){
+    const std::string text = "41º 59' 4\" S 2º 49' 16\" W";
+    conn::GPSPoint point{};
+    const conn::ParseResult result = conn::parseGPSPoint(
+        text.data(),
+        text.data() + text.size(),
+        point
+    );
+
+    const std::string formattedText = conn::stringFromGPSPoint(
+        conn::gpsPointFromDegrees(conn::GeoPoint{-41.984444, -2.821111})
+    );
+    conn::GPSPoint formattedPoint{};
+    conn::parseGPSPoint(
+        formattedText.data(),
+        formattedText.data() + formattedText.size(),
+        formattedPoint
+    );
+
+    return check(
+        std::errc() == result.error
+            && fabs(
+                conn::degreesFromGPSCoordinate(point.latitude) + 41.984444
+            ) < 1e-6
+            && fabs(
+                conn::degreesFromGPSCoordinate(point.longitude) + 2.821111
+            ) < 1e-6,
+        "parseGPSPoint of a S and W point"
+    ) && check(
+        fabs(
+            conn::degreesFromGPSCoordinate(formattedPoint.latitude) + 41.984444
+        ) < 1. / 3600.
+            && fabs(
+                conn::degreesFromGPSCoordinate(formattedPoint.longitude)
+                    + 2.821111
+            ) < 1. / 3600.,
+        "parseGPSPoint of stringFromGPSPoint()"
+    ) && check(
+        checkGPSPointRoundTrip(conn::GeoPoint{0.5, 0.999})
+            && checkGPSPointRoundTrip(conn::GeoPoint{-0.5, -0.999})
+            && checkGPSPointRoundTrip(conn::GeoPoint{0., 0.}),
+        "parseGPSPoint of stringFromGPSPoint() within 1 degree of zero"
+    );
+}
+
+static bool checkDistanceMatrixThreads(){
+    const double latitudes[] = {41.98, 42.5, 43.1};
+    const double longitudes[] = {2.82, 3.4, 4.2};
+    std::vector<double> matrix(9);
+    std::vector<double> expectedMatrix(9);
+
+    conn::distanceMatrix(latitudes, longitudes, 3, matrix.data(), false, 0);
+    conn::distanceMatrix(
+        latitudes,
+        longitudes,
+        3,
+        expectedMatrix.data(),
+        false,
+        1
+    );
+
+    return check(
+        matrix == expectedMatrix,
+        "distanceMatrix with zero threads"
+    );
+}
+
+static bool checkDistanceMatrixRadius(){
+    const double latitudes[] = {41.98, 42.5, -43.1};
+    const double longitudes[] = {2.82, 179.9, -179.8};
+    std::vector<double> matrix(9);
+    bool isMatching = true;
+
+    conn::distanceMatrix(latitudes, longitudes, 3, matrix.data(), true, 2);
+
+    for(std::size_t i = 0; i < 3; ++i){
+        for(std::size_t j = 0; j < 3; ++j){
+            const double expected = conn::distance(
+                latitudes[i],
+                longitudes[i],
+                latitudes[j],
+                longitudes[j],
+                true
+            );
+
+            isMatching = isMatching
+                && fabs(matrix[3 * i + j] - expected) <= 1e-8 * expected;
+        }
+    }
+
+    return check(isMatching, "distanceMatrix with WSG-84 radius");
+}
+
+static bool checkNormalizedLongitudes(){
+    const conn::GeoPoint east = conn::destination(
+        conn::GeoPoint{10., 1000.},
+        1000.,
+        90.
+    );
+    const conn::GeoPoint west = conn::destination(
+        conn::GeoPoint{10., -1000.},
+        1000.,
+        270.
+    );
+
+    return check(
+        fabs(east.longitude + 79.990868) < 1e-6
+            && fabs(west.longitude - 79.990868) < 1e-6,
+        "destination from a longitude beyond 540 degrees"
+    );
+}
+
+static bool checkGeofenceSetDistances(){
+    conn::GeofenceSet geofences(0.01);
+    std::vector<conn::Geofence> fences;
+    const double centers[][2] = {
+        {41.98, 2.82}, {41.99, 2.83}, {42.2, 2.8}, {10., 179.995},
+        {10., -179.99}, {-30., 20.}, {41.9, 2.5}
+    };
+    const double radii[] = {200., 50., 300., 400., 150., 100., 40000.};
+    const double earthRadii[] = {
+        conn::earthRadius, 0.25 * conn::earthRadius, conn::earthRadius,
+        conn::earthRadius, 2. * conn::earthRadius, conn::earthRadius,
+        conn::earthRadius
+    };
+
+    for(std::size_t i = 0; i < 7; ++i){
+        std::vector<conn::GeoPoint> vertices;
+
+        for(std::size_t j = 0; j < 12; ++j){
+            vertices.push_back(
+                conn::destination(
+                    conn::GeoPoint{centers[i][0], centers[i][1]},
+                    radii[i] * (1. + 0.2 * (j % 2)),
+                    conn::pi / 6. * j,
+                    false
+                )
+            );
+        }
+
+        fences.push_back(conn::Geofence(vertices, earthRadii[i]));
+        geofences.insert(fences.back());
+    }
+
+    bool isMatching = true;
+
+    for(std::size_t i = 0; i < 4000; ++i){
+        const double maximumDistance = 100. * (1 + i % 50);
+        const conn::GeoPoint point = 0 == i % 2
+            ? conn::destination(
+                conn::GeoPoint{41.98, 2.82},
+                10. * i,
+                0.37 * i,
+                false
+            )
+            : conn::destination(
+                conn::GeoPoint{10., 180.},
+                i,
+                0.37 * i,
+                false
+            );
+        double expected = maximumDistance;
+
+        for(const conn::Geofence &fence : fences){
+            expected = std::min(expected, fence.distanceToBoundary(point));
+        }
+
+        isMatching = isMatching && expected == geofences.distanceToBoundary(
+            point,
+            maximumDistance
+        );
+    }
+
+    return check(
+        isMatching,
+        "GeofenceSet::distanceToBoundary matching a scan of all fences"
+    );
+}
+
+static bool checkWaypointIndexNearest(){
+    const conn::GeoPoint origin{41.98, 2.82};
+    conn::WaypointIndex waypointIndex(50.);
+
+    for(std::size_t i = 0; i < 500; ++i){
+        waypointIndex.insert(
+            conn::destination(origin, 3. * i, 0.61 * i, false)
+        );
+    }
+
+    bool isMatching = true;
+
+    for(std::size_t i = 0; i < 50; ++i){
+        const conn::GeoPoint point = conn::destination(
+            origin,
+            30. * i,
+            0.23 * i,
+            false
+        );
+        const std::vector<conn::WaypointMatch> matches(
+            waypointIndex.nearest(point, 1 + i % 10)
+        );
+        std::vector<double> distances;
+
+        for(std::size_t j = 0; j < waypointIndex.size(); ++j){
+            const conn::GeoPoint waypoint = waypointIndex.getPoint(j);
+
+            distances.push_back(
+                conn::distance(
+                    point.latitude,
+                    point.longitude,
+                    waypoint.latitude,
+                    waypoint.longitude
+                )
+            );
+        }
+
+        std::sort(distances.begin(), distances.end());
+        isMatching = isMatching && matches.size() == 1 + i % 10;
+
+        for(std::size_t j = 0; isMatching && j < matches.size(); ++j){
+            isMatching = fabs(matches[j].distance - distances[j]) < 1e-6;
+        }
+    }
+
+    return check(isMatching, "WaypointIndex::nearest matching a sort");
+}
+
+static bool checkWaypointIndexPath(){
+    const conn::GeoPoint origin{41.98, 2.82};
+    conn::Path path(conn::LocalPoint{0., 0.});
+    conn::spiral(path, 10., 0., 5000., 6. * conn::pi, 300);
+
+    const std::size_t numberOfPoints = conn::countPoints(path);
+    std::vector<double> latitudes(numberOfPoints);
+    std::vector<double> longitudes(numberOfPoints);
+    std::vector<conn::LocalPoint> localPoints(numberOfPoints);
+    conn::WaypointIndex pathIndex;
+    conn::WaypointIndex pointIndex;
+
+    conn::projectPath(path, origin, latitudes.data(), longitudes.data());
+    conn::fillPoints(path, localPoints.data());
+    pathIndex.insert(origin, path);
+    pointIndex.insert(origin, localPoints);
+
+    bool isMatching = pathIndex.size() == numberOfPoints
+        && pointIndex.size() == numberOfPoints;
+
+    for(std::size_t i = 0; isMatching && i < numberOfPoints; ++i){
+        const conn::GeoPoint first = pathIndex.getPoint(i);
+        const conn::GeoPoint second = pointIndex.getPoint(i);
+
+        isMatching = first.latitude == latitudes[i]
+            && first.longitude == longitudes[i]
+            && second.latitude == latitudes[i]
+            && second.longitude == longitudes[i];
+    }
+
+    return check(isMatching, "WaypointIndex::insert matching projectPath");
+}
+
+static bool checkPlanStreamMove(){
+    conn::Path path(conn::LocalPoint{0., 0.});
+    conn::spiral(path, 10., 0., 5000., 6. * conn::pi, 3000);
+
+    conn::PlanStream stream = conn::planAsync(
+        path,
+        conn::GeoPoint{41.98, 2.82}
+    );
+    conn::PlanStream owner(std::move(stream));
+    conn::WaypointChunk chunk;
+    std::size_t numberOfPoints = 0;
+
+    while(owner.next(chunk)){
+        numberOfPoints += chunk.latitudes.size();
+    }
+
+    return check(
+        numberOfPoints == conn::countPoints(path) && owner.isDone()
+            && !stream.tryNext(chunk) && !stream.next(chunk)
+            && stream.isDone() && !stream.isCancelled(),
+        "PlanStream moved from being empty"
+    );
+}
+
+static bool checkWaypointFileRoundTrip(){
+    const std::string fileName = "check.waypoints";
+    const conn::GeoPoint origin{41.98, 2.82};
+    const conn::WaypointFileHeader header = conn::waypointFileHeader(origin);
+    std::vector<conn::GeoPoint> points;
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+
+    for(std::size_t i = 0; i < 1300; ++i){
+        points.push_back(conn::destination(origin, 7. * i, 0.41 * i, false));
+        latitudes.push_back(points.back().latitude);
+        longitudes.push_back(points.back().longitude);
+    }
+
+    bool isMatching = true;
+
+    for(std::size_t pass = 0; pass < 2; ++pass){
+        if(0 == pass){
+            conn::writeWaypointFile(fileName, header, points);
+        }else{
+            conn::writeWaypointFile(
+                fileName,
+                header,
+                latitudes.data(),
+                longitudes.data(),
+                points.size()
+            );
+        }
+
+        const conn::WaypointFile file(fileName);
+
+        isMatching = isMatching && file.size() == points.size();
+
+        for(std::size_t i = 0; isMatching && i < points.size(); ++i){
+            const conn::WaypointRecord expected =
+                conn::waypointRecordFromGeoPoint(points[i]);
+
+            isMatching = file.data()[i].latitude == expected.latitude
+                && file.data()[i].longitude == expected.longitude;
+        }
+    }
+
+    std::remove(fileName.c_str());
+
+    return check(isMatching, "writeWaypointFile read back by WaypointFile");
+}
+
+static bool runChecks(){
+    bool isPassed = true;
+
+    isPassed = checkParseGPSPoint() && isPassed;
+    isPassed = checkDistanceMatrixThreads() && isPassed;
+    isPassed = checkDistanceMatrixRadius() && isPassed;
+    isPassed = checkNormalizedLongitudes() && isPassed;
+    isPassed = checkGeofenceSetDistances() && isPassed;
+    isPassed = checkWaypointIndexNearest() && isPassed;
+    isPassed = checkWaypointIndexPath() && isPassed;
+    isPassed = checkPlanStreamMove() && isPassed;
+    isPassed = checkWaypointFileRoundTrip() && isPassed;
+
+    return isPassed;
+}
+
+int main(const int argc, const char *argv[]){
+    if(1 < argc){
+        filter = argv[1];
+    }
+
+    if(!runChecks()){
+        return 1;
+    }
+
+    const conn::GeoPoint origin{41.984444, 2.821111};
+    const std::size_t sizes[] = {1, 1000, 1000000};
+    const std::size_t numberOfThreads = std::max(
+        1u,
+        std::thread::hardware_concurrency()
+    );
+
+    std::printf(
+        "%-44s %8s %12s %12s\n",
+        "function",
+        "size",
+        "ns/op",
+        "allocs/op"
+    );
+
+    for(const std::size_t size : sizes){
+        std::vector<double> latitudes(size);
+        std::vector<double> longitudes(size);
+        std::vector<double> distances(size);
+        std::vector<double> bearings(size);
+        std::vector<double> xs(size);
+        std::vector<double> ys(size);
+        std::vector<double> nextLatitudes(size);
+        std::vector<double> nextLongitudes(size);
+        std::vector<double> results(size);
+
+        for(std::size_t i = 0; i < size; ++i){
+            distances[i] = 10. + std::fmod(i * 7.31, 5000.);
+            bearings[i] = std::fmod(i * 13.7, 360.);
+            xs[i] = distances[i] * sin(conn::radiansFromDegrees(bearings[i]));
+            ys[i] = distances[i] * cos(conn::radiansFromDegrees(bearings[i]));
+
+            const conn::GeoPoint point = conn::destination(
+                origin,
+                distances[i],
+                bearings[i]
+            );
+
+            latitudes[i] = point.latitude;
+            longitudes[i] = point.longitude;
+        }
+
+        measure("calculateEarthRadius", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::calculateEarthRadius(latitudes[i]);
+            }
+
+            sink = sum;
+        });
+
+        measure("tabulatedEarthRadius", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::tabulatedEarthRadius(latitudes[i]);
+            }
+
+            sink = sum;
+        });
+
+        measure("EarthRadiusCache::radius", size, size, [&](){
+            conn::EarthRadiusCache cache;
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += cache.radius(latitudes[i]);
+            }
+
+            sink = sum;
+        });
+
+        measure("distance(GeoPoint)", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::distance(
+                    origin,
+                    conn::GeoPoint{latitudes[i], longitudes[i]}
+                );
+            }
+
+            sink = sum;
+        });
+
+        measure("distance(GeoPoint, WSG-84)", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::distance(
+                    origin,
+                    conn::GeoPoint{latitudes[i], longitudes[i]},
+                    true
+                );
+            }
+
+            sink = sum;
+        });
+
+        measure("distance(GeoPoint, EarthRadiusCache)", size, size, [&](){
+            conn::EarthRadiusCache cache;
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::distance(
+                    origin,
+                    conn::GeoPoint{latitudes[i], longitudes[i]},
+                    cache
+                );
+            }
+
+            sink = sum;
+        });
+
+        measure("distance(vector)", size, size, [&](){
+            const std::vector< std::vector<double> > start =
+                conn::gpsPointFromDegrees(origin.latitude, origin.longitude);
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::distance(
+                    start,
+                    conn::gpsPointFromDegrees(latitudes[i], longitudes[i])
+                );
+            }
+
+            sink = sum;
+        });
+
+        measure("distanceOneToMany", size, size, [&](){
+            conn::distanceOneToMany(
+                origin,
+                latitudes.data(),
+                longitudes.data(),
+                size,
+                results.data()
+            );
+
+            sink = results[size - 1];
+        });
+
+        measure("destination(GeoPoint)", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::destination(
+                    origin,
+                    distances[i],
+                    bearings[i]
+                ).latitude;
+            }
+
+            sink = sum;
+        });
+
+        measure("destination(GeoPoint, WSG-84)", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::destination(
+                    origin,
+                    distances[i],
+                    bearings[i],
+                    true
+                ).latitude;
+            }
+
+            sink = sum;
+        });
+
+        measure("destination(vector)", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::destination(
+                    origin.latitude,
+                    origin.longitude,
+                    distances[i],
+                    bearings[i]
+                )[0];
+            }
+
+            sink = sum;
+        });
+
+        measure("destinations", size, size, [&](){
+            conn::destinations(
+                origin,
+                distances.data(),
+                bearings.data(),
+                size,
+                nextLatitudes.data(),
+                nextLongitudes.data()
+            );
+
+            sink = nextLatitudes[size - 1];
+        });
+
+        measure("inverse", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::inverse(
+                    origin,
+                    conn::GeoPoint{latitudes[i], longitudes[i]}
+                ).initialBearing;
+            }
+
+            sink = sum;
+        });
+
+        measure("legs", size, size, [&](){
+            conn::legs(
+                latitudes.data(),
+                longitudes.data(),
+                size,
+                results.data(),
+                nextLatitudes.data(),
+                nextLongitudes.data()
+            );
+
+            sink = results[0];
+        });
+
+        measure("fastSinCos", size, size, [&](){
+            conn::fastSinCos(
+                bearings.data(),
+                size,
+                nextLatitudes.data(),
+                nextLongitudes.data()
+            );
+
+            sink = nextLatitudes[size - 1];
+        });
+
+        measure("fastAtan2", size, size, [&](){
+            conn::fastAtan2(
+                xs.data(),
+                ys.data(),
+                size,
+                results.data()
+            );
+
+            sink = results[size - 1];
+        });
+
+        measure("distance<SphericalEarth>", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::distance<conn::SphericalEarth<>>(
+                    origin,
+                    conn::GeoPoint{latitudes[i], longitudes[i]}
+                );
+            }
+
+            sink = sum;
+        });
+
+        measure("distance<VincentyEarth>", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::distance<conn::VincentyEarth<>>(
+                    origin,
+                    conn::GeoPoint{latitudes[i], longitudes[i]}
+                );
+            }
+
+            sink = sum;
+        });
+
+        measure("destination<VincentyEarth>", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::destination<conn::VincentyEarth<>>(
+                    origin,
+                    distances[i],
+                    bearings[i]
+                ).latitude;
+            }
+
+            sink = sum;
+        });
+
+        measure("inverses<VincentyEarth>", size, size, [&](){
+            std::fill(xs.begin(), xs.end(), origin.latitude);
+            std::fill(ys.begin(), ys.end(), origin.longitude);
+            conn::inverses<conn::VincentyEarth<>>(
+                xs.data(),
+                ys.data(),
+                latitudes.data(),
+                longitudes.data(),
+                size,
+                results.data(),
+                nextLatitudes.data(),
+                nextLongitudes.data()
+            );
+
+            sink = results[0];
+        });
+
+        measure("LocalFrame::geoPoints", size, size, [&](){
+            const conn::LocalFrame frame(origin);
+
+            frame.geoPoints(
+                xs.data(),
+                ys.data(),
+                size,
+                nextLatitudes.data(),
+                nextLongitudes.data()
+            );
+
+            sink = nextLatitudes[size - 1];
+        });
+
+        measure("LocalFrame::localPoints", size, size, [&](){
+            const conn::LocalFrame frame(origin);
+
+            frame.localPoints(
+                latitudes.data(),
+                longitudes.data(),
+                size,
+                xs.data(),
+                ys.data()
+            );
+
+            sink = xs[size - 1];
+        });
+
+        measure("dmsFromDegrees", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::dmsFromDegrees(latitudes[i]).seconds;
+            }
+
+            sink = sum;
+        });
+
+        measure("gpsCoordinateFromDegrees", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::gpsCoordinateFromDegrees(latitudes[i])[2];
+            }
+
+            sink = sum;
+        });
+
+        measure("stringFromGPSPoint", size, size, [&](){
+            std::size_t sum = 0;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::stringFromGPSPoint(
+                    conn::gpsPointFromDegrees(
+                        conn::GeoPoint{latitudes[i], longitudes[i]}
+                    )
+                ).size();
+            }
+
+            sink = sum;
+        });
+
+        measure("formatGPSPoint", size, size, [&](){
+            char buffer[conn::gpsPointBufferSize];
+            std::size_t sum = 0;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += conn::formatGPSPoint(
+                    buffer,
+                    buffer + conn::gpsPointBufferSize,
+                    conn::gpsPointFromDegrees(
+                        conn::GeoPoint{latitudes[i], longitudes[i]}
+                    ),
+                    3
+                ).pointer - buffer;
+            }
+
+            sink = sum;
+        });
+
+        std::vector<char> texts(size * conn::gpsPointBufferSize);
+        std::vector<const char *> textEnds(size);
+
+        for(std::size_t i = 0; i < size; ++i){
+            char *text = texts.data() + i * conn::gpsPointBufferSize;
+
+            textEnds[i] = conn::formatGPSPoint(
+                text,
+                text + conn::gpsPointBufferSize,
+                conn::gpsPointFromDegrees(
+                    conn::GeoPoint{latitudes[i], longitudes[i]}
+                ),
+                3
+            ).pointer;
+        }
+
+        measure("parseGPSPoint", size, size, [&](){
+            conn::GPSPoint point{};
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                conn::parseGPSPoint(
+                    texts.data() + i * conn::gpsPointBufferSize,
+                    textEnds[i],
+                    point
+                );
+                sum += point.latitude.seconds;
+            }
+
+            sink = sum;
+        });
+
+        const std::string waypointFileName = "bench.waypoints";
+        const conn::WaypointFileHeader header = conn::waypointFileHeader(
+            origin
+        );
+
+        measure("writeWaypointFile", size, size, [&](){
+            conn::writeWaypointFile(
+                waypointFileName,
+                header,
+                latitudes.data(),
+                longitudes.data(),
+                size
+            );
+        });
+
+        measure("WaypointFile::geoPoints", size, size, [&](){
+            const conn::WaypointFile file(waypointFileName);
+
+            file.geoPoints(nextLatitudes.data(), nextLongitudes.data());
+
+            sink = nextLatitudes[size - 1];
+        });
+
+        std::remove(waypointFileName.c_str());
+
+        std::ofstream nowhere("/dev/null", std::ios::binary);
+
+        measure("GPXSink::write", size, size, [&](){
+            conn::GPXSink sink(nowhere);
+
+            sink.write(latitudes.data(), longitudes.data(), size);
+            sink.finish();
+        });
+
+        measure("GeoJSONSink::write", size, size, [&](){
+            conn::GeoJSONSink sink(nowhere);
+
+            sink.write(latitudes.data(), longitudes.data(), size);
+            sink.finish();
+        });
+
+        measure("NMEASink::write", size, size, [&](){
+            conn::NMEASink sink(nowhere);
+
+            sink.write(latitudes.data(), longitudes.data(), size);
+            sink.finish();
+        });
+
+        measure("spiral(vector)", size, size, [&](){
+            std::vector< std::vector<double> > points;
+            points.push_back(std::vector<double>{0., 0.});
+
+            conn::spiral(points, 10., 0., 1000., 20. * conn::pi, size);
+
+            sink = points.back()[0];
+        });
+
+        measure("spiral(LocalPoint)", size, size, [&](){
+            std::vector<conn::LocalPoint> points(1, conn::LocalPoint{0., 0.});
+
+            conn::spiral(points, 10., 0., 1000., 20. * conn::pi, size);
+
+            sink = points.back().x;
+        });
+
+        measure("spiral(Path) + fillPoints", size, size, [&](){
+            std::vector<conn::LocalPoint> points(size);
+            conn::Path path(conn::LocalPoint{0., 0.});
+
+            conn::spiral(path, 10., 0., 1000., 20. * conn::pi, size);
+            conn::fillPoints(path, points.data());
+
+            sink = points.back().x;
+        });
+
+        std::vector<conn::LocalPoint> spiralPoints(size);
+        conn::Path spiralPath(conn::LocalPoint{0., 0.});
+        conn::spiral(spiralPath, 10., 0., 1000., 20. * conn::pi, size);
+        conn::fillPoints(spiralPath, spiralPoints.data());
+
+        measure("douglasPeucker", size, size, [&](){
+            sink = conn::douglasPeucker(spiralPoints, 1.).size();
+        });
+
+        measure("visvalingam", size, size, [&](){
+            sink = conn::visvalingam(spiralPoints, 1.).size();
+        });
+
+        std::vector<double> spiralLatitudes(size);
+        std::vector<double> spiralLongitudes(size);
+        std::vector<conn::GeoPoint> spiralGeoPoints(size);
+        conn::projectPath(
+            spiralPath,
+            origin,
+            spiralLatitudes.data(),
+            spiralLongitudes.data()
+        );
+
+        for(std::size_t i = 0; i < size; ++i){
+            spiralGeoPoints[i] = conn::GeoPoint{
+                spiralLatitudes[i],
+                spiralLongitudes[i]
+            };
+        }
+
+        measure("visvalingam(GeoPoint)", size, size, [&](){
+            sink = conn::visvalingam(spiralGeoPoints, 1.).size();
+        });
+
+        measure("StreamingSimplifier::push", size, size, [&](){
+            std::size_t numberOfKeptPoints = 0;
+            auto simplifier = conn::makeStreamingSimplifier<conn::LocalPoint>(
+                1.,
+                [&](const conn::LocalPoint &){
+                    ++numberOfKeptPoints;
+                }
+            );
+
+            for(std::size_t i = 0; i < size; ++i){
+                simplifier.push(spiralPoints[i]);
+            }
+
+            simplifier.finish();
+
+            sink = numberOfKeptPoints;
+        });
+
+        measure("projectPath", size, size, [&](){
+            conn::projectPath(
+                spiralPath,
+                origin,
+                nextLatitudes.data(),
+                nextLongitudes.data()
+            );
+
+            sink = nextLatitudes[size - 1];
+        });
+
+        measure("projectPath(threads)", size, size, [&](){
+            conn::projectPath(
+                spiralPath,
+                origin,
+                nextLatitudes.data(),
+                nextLongitudes.data(),
+                numberOfThreads
+            );
+
+            sink = nextLatitudes[size - 1];
+        });
+
+        measure("planAsync", size, size, [&](){
+            conn::PlanStream stream = conn::planAsync(spiralPath, origin);
+            conn::WaypointChunk chunk;
+
+            while(stream.next(chunk)){
+                std::copy(
+                    chunk.latitudes.begin(),
+                    chunk.latitudes.end(),
+                    nextLatitudes.begin() + chunk.offset
+                );
+            }
+
+            sink = nextLatitudes[size - 1];
+        });
+
+        measure("DeadReckoning::moveAlong", size, size, [&](){
+            conn::DeadReckoning reckoning(origin);
+
+            reckoning.moveAlong(
+                spiralPoints.data(),
+                size,
+                nextLatitudes.data(),
+                nextLongitudes.data()
+            );
+
+            sink = nextLatitudes[size - 1];
+        });
+
+        conn::WaypointIndex waypointIndex(1.);
+        conn::projectPath(
+            spiralPath,
+            origin,
+            nextLatitudes.data(),
+            nextLongitudes.data()
+        );
+
+        measure("WaypointIndex::insert", size, size, [&](){
+            waypointIndex = conn::WaypointIndex(1.);
+            waypointIndex.insert(
+                nextLatitudes.data(),
+                nextLongitudes.data(),
+                size
+            );
+
+            sink = waypointIndex.size();
+        });
+
+        const std::size_t queryStep = std::max<std::size_t>(1, size / 1000);
+
+        measure("WaypointIndex::nearest", size, size / queryStep, [&](){
+            double total = 0.;
+
+            for(std::size_t i = 0; i < size; i += queryStep){
+                total += waypointIndex.nearest(
+                    conn::GeoPoint{
+                        nextLatitudes[i] + 1e-5,
+                        nextLongitudes[i]
+                    },
+                    8
+                ).back().distance;
+            }
+
+            sink = total;
+        });
+
+        conn::WaypointMatch matches[8];
+
+        measure("WaypointIndex::nearest(buffer)", size, size / queryStep, [&](){
+            double total = 0.;
+
+            for(std::size_t i = 0; i < size; i += queryStep){
+                const std::size_t numberOfMatches = waypointIndex.nearest(
+                    conn::GeoPoint{
+                        nextLatitudes[i] + 1e-5,
+                        nextLongitudes[i]
+                    },
+                    8,
+                    matches
+                );
+
+                total += matches[numberOfMatches - 1].distance;
+            }
+
+            sink = total;
+        });
+
+        conn::GeofenceSet geofences(0.01);
+        std::vector<std::size_t> fenceIndexes(size);
+
+        for(std::size_t i = 0; i < 500; ++i){
+            const double angle = 0.1 * i;
+            const double distance = 10. * i;
+            std::vector<conn::GeoPoint> vertices;
+
+            for(std::size_t j = 0; j < 16; ++j){
+                vertices.push_back(
+                    conn::destination(
+                        conn::destination(origin, distance, angle, false),
+                        20. + 10. * (j % 2),
+                        conn::pi / 8. * j,
+                        false
+                    )
+                );
+            }
+
+            geofences.insert(vertices);
+        }
+
+        measure("GeofenceSet::firstContaining", size, size, [&](){
+            sink = geofences.firstContaining(
+                nextLatitudes.data(),
+                nextLongitudes.data(),
+                size,
+                fenceIndexes.data()
+            );
+        });
+
+        std::vector<double> fenceDistances(size);
+
+        measure("GeofenceSet::distancesToBoundary", size, size, [&](){
+            geofences.distancesToBoundary(
+                nextLatitudes.data(),
+                nextLongitudes.data(),
+                size,
+                100.,
+                fenceDistances.data()
+            );
+            sink = fenceDistances[0];
+        });
+
+        const std::size_t numberOfLines = 8;
+        const std::size_t numberOfPoints = std::max<std::size_t>(
+            1,
+            size / conn::countSquiggleSegments(numberOfLines)
+        );
+        const std::size_t numberOfSquigglePoints = conn::countSquigglePoints(
+            numberOfLines,
+            numberOfPoints
+        );
+
+        measure("squiggle(vector)", size, numberOfSquigglePoints, [&](){
+            std::vector< std::vector<double> > points;
+            points.push_back(std::vector<double>{0., 0.});
+
+            conn::squiggle(
+                points,
+                1000.,
+                1000.,
+                0.5 * conn::pi,
+                conn::pi,
+                numberOfLines,
+                numberOfPoints
+            );
+
+            sink = points.back()[0];
+        });
+
+        measure("squiggle(LocalPoint)", size, numberOfSquigglePoints, [&](){
+            std::vector<conn::LocalPoint> points(1, conn::LocalPoint{0., 0.});
+
+            conn::squiggle(
+                points,
+                1000.,
+                1000.,
+                0.5 * conn::pi,
+                conn::pi,
+                numberOfLines,
+                numberOfPoints
+            );
+
+            sink = points.back().x;
+        });
+
+        conn::MonotonicArena arena;
+
+        measure("squiggle(ArenaPoints)", size, numberOfSquigglePoints, [&](){
+            arena.release();
+
+            conn::ArenaPoints points(&arena);
+
+            points.push_back(conn::LocalPoint{0., 0.});
+            conn::squiggle(
+                points,
+                1000.,
+                1000.,
+                0.5 * conn::pi,
+                conn::pi,
+                numberOfLines,
+                numberOfPoints
+            );
+
+            sink = points.back().x;
+        });
+
+        const conn::Squiggle randomAccessSquiggle(
+            conn::LocalPoint{0., 0.},
+            1000.,
+            1000.,
+            0.5 * conn::pi,
+            conn::pi,
+            numberOfLines,
+            numberOfPoints
+        );
+
+        measure("Squiggle::point", size, numberOfSquigglePoints, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < numberOfSquigglePoints; ++i){
+                sum += randomAccessSquiggle.point(
+                    (i * 7919) % numberOfSquigglePoints
+                ).x;
+            }
+
+            sink = sum;
+        });
+
+        conn::Path squigglePath(conn::LocalPoint{0., 0.});
+        conn::squiggle(
+            squigglePath,
+            1000.,
+            1000.,
+            0.5 * conn::pi,
+            conn::pi,
+            numberOfLines,
+            numberOfPoints
+        );
+        const conn::PathLocator locator(squigglePath);
+
+        measure("PathLocator::locate", size, size, [&](){
+            double sum = 0.;
+
+            for(std::size_t i = 0; i < size; ++i){
+                sum += locator.locate(
+                    conn::LocalPoint{xs[i], ys[i]}
+                ).crossTrackError;
+            }
+
+            sink = sum;
+        });
+
+        const conn::Transform2D rotation = conn::rotationTransform(0.1);
+        std::vector<double> squiggleLatitudes(numberOfSquigglePoints);
+        std::vector<double> squiggleLongitudes(numberOfSquigglePoints);
+
+        measure("transformPath", size, numberOfSquigglePoints, [&](){
+            sink = conn::transformPath(
+                squigglePath,
+                rotation
+            ).segments.back().offset.x;
+        });
+
+        measure(
+            "projectPath(TransformedPath)",
+            size,
+            numberOfSquigglePoints,
+            [&](){
+                conn::projectPath(
+                    conn::TransformedPath(squigglePath, rotation),
+                    origin,
+                    squiggleLatitudes.data(),
+                    squiggleLongitudes.data()
+                );
+
+                sink = squiggleLatitudes[numberOfSquigglePoints - 1];
+            }
+        );
+
+        // Matrices grow as a square of the number of points, so they are
+        // measured for a square root of the size.
+        const std::size_t matrixSize = std::max<std::size_t>(
+            2,
+            static_cast<std::size_t>(sqrt(2. * size))
+        );
+        const std::size_t numberOfPairs = matrixSize * (matrixSize - 1) / 2;
+        std::vector<double> matrix(numberOfPairs);
+
+        if(matrixSize > size){
+            continue;
+        }
+
+        measure(
+            "upperTriangularDistanceMatrix",
+            matrixSize,
+            numberOfPairs,
+            [&](){
+                conn::upperTriangularDistanceMatrix(
+                    latitudes.data(),
+                    longitudes.data(),
+                    matrixSize,
+                    matrix.data()
+                );
+
+                sink = matrix[0];
+            }
+        );
+
+        measure(
+            "upperTriangularDistanceMatrix(threads)",
+            matrixSize,
+            numberOfPairs,
+            [&](){
+                conn::upperTriangularDistanceMatrix(
+                    latitudes.data(),
+                    longitudes.data(),
+                    matrixSize,
+                    matrix.data(),
+                    false,
+                    numberOfThreads
+                );
+
+                sink = matrix[0];
+            }
+        );
+    }
+
+    return 0;
+}
@@ -0,0 +1,351 @@
+/// \file conn.cc
+/// \author Egor Starobinskii
+/// \date 12 Oct 2018
+/// \brief Explicit template instances of ConnSailLib
+/// \details Compiles the double and float instances of the hot templates 
+/// once for libconn.a and libconn.so, see 'make lib'. Define 
+/// CONN_EXTERN_TEMPLATES before including the lib and link one of them to 
+/// skip these instances in your translation units. The instances are 
+/// built with the default configuration, which the extern declarations 
+/// require.
+
+#if defined(CONN_FAST_TRIG) || defined(CONN_INSTRUMENTATION) \
+    || defined(CONN_NO_CHECKS)
+    #error "conn.cc builds the instances of the default configuration"
+#endif
+
+#include "conn.hh"
+
+namespace conn{
+    template double sphericalDistance<double>(
+        const double,
+        const double,
+        const double,
+        const double,
+        const double
+    );
+    template conn::BasicInverse<double> sphericalInverse<double>(
+        const conn::BasicGeoPoint<double>,
+        const conn::BasicGeoPoint<double>,
+        const double
+    );
+    template conn::BasicGeoPoint<double> sphericalDestination<double>(
+        const conn::BasicGeoPoint<double>,
+        const double,
+        const double,
+        const double
+    );
+    template conn::BasicGeoPoint<double> destinationByAngles<double>(
+        const conn::BasicGeoPoint<double>,
+        const double,
+        const double,
+        const double,
+        const double
+    );
+    template conn::BasicInverse<double> vincentyInverse<double>(
+        const conn::BasicGeoPoint<double>,
+        const conn::BasicGeoPoint<double>,
+        const std::size_t,
+        const bool
+    );
+    template conn::BasicGeoPoint<double> vincentyDestination<double>(
+        const conn::BasicGeoPoint<double>,
+        const double,
+        const double,
+        const std::size_t
+    );
+    template void destinations<double>(
+        const conn::BasicGeoPoint<double>,
+        const double *,
+        const double *,
+        const std::size_t,
+        double *,
+        double *,
+        const bool
+    );
+    template void destinations<double>(
+        const double *,
+        const double *,
+        const double *,
+        const double *,
+        const std::size_t,
+        double *,
+        double *,
+        const bool
+    );
+    template void inverses<double>(
+        const double *,
+        const double *,
+        const double *,
+        const double *,
+        const std::size_t,
+        double *,
+        double *,
+        double *,
+        const bool
+    );
+    template void legs<double>(
+        const double *,
+        const double *,
+        const std::size_t,
+        double *,
+        double *,
+        double *,
+        const bool
+    );
+    template void distanceOneToMany<double>(
+        const conn::BasicGeoPoint<double>,
+        const double *,
+        const double *,
+        const std::size_t,
+        double *,
+        const bool
+    );
+    template void upperTriangularDistanceMatrix<double>(
+        const double *,
+        const double *,
+        const std::size_t,
+        double *,
+        const bool,
+        const std::size_t
+    );
+    template void distanceMatrix<double>(
+        const double *,
+        const double *,
+        const std::size_t,
+        double *,
+        const bool,
+        const std::size_t
+    );
+    template void fastSinCos<double>(
+        const double,
+        double &,
+        double &
+    );
+    template void fastSinCos<double>(
+        const double *,
+        const std::size_t,
+        double *,
+        double *
+    );
+    template double fastAtan2<double>(
+        const double,
+        const double
+    );
+    template void fastAtan2<double>(
+        const double *,
+        const double *,
+        const std::size_t,
+        double *
+    );
+    template class conn::BasicLocalFrame<double>;
+
+    template float sphericalDistance<float>(
+        const float,
+        const float,
+        const float,
+        const float,
+        const float
+    );
+    template conn::BasicInverse<float> sphericalInverse<float>(
+        const conn::BasicGeoPoint<float>,
+        const conn::BasicGeoPoint<float>,
+        const float
+    );
+    template conn::BasicGeoPoint<float> sphericalDestination<float>(
+        const conn::BasicGeoPoint<float>,
+        const float,
+        const float,
+        const float
+    );
+    template conn::BasicGeoPoint<float> destinationByAngles<float>(
+        const conn::BasicGeoPoint<float>,
+        const float,
+        const float,
+        const float,
+        const float
+    );
+    template conn::BasicInverse<float> vincentyInverse<float>(
+        const conn::BasicGeoPoint<float>,
+        const conn::BasicGeoPoint<float>,
+        const std::size_t,
+        const bool
+    );
+    template conn::BasicGeoPoint<float> vincentyDestination<float>(
+        const conn::BasicGeoPoint<float>,
+        const float,
+        const float,
+        const std::size_t
+    );
+    template void destinations<float>(
+        const conn::BasicGeoPoint<float>,
+        const float *,
+        const float *,
+        const std::size_t,
+        float *,
+        float *,
+        const bool
+    );
+    template void destinations<float>(
+        const float *,
+        const float *,
+        const float *,
+        const float *,
+        const std::size_t,
+        float *,
+        float *,
+        const bool
+    );
+    template void inverses<float>(
+        const float *,
+        const float *,
+        const float *,
+        const float *,
+        const std::size_t,
+        float *,
+        float *,
+        float *,
+        const bool
+    );
+    template void legs<float>(
+        const float *,
+        const float *,
+        const std::size_t,
+        float *,
+        float *,
+        float *,
+        const bool
+    );
+    template void distanceOneToMany<float>(
+        const conn::BasicGeoPoint<float>,
+        const float *,
+        const float *,
+        const std::size_t,
+        float *,
+        const bool
+    );
+    template void upperTriangularDistanceMatrix<float>(
+        const float *,
+        const float *,
+        const std::size_t,
+        float *,
+        const bool,
+        const std::size_t
+    );
+    template void distanceMatrix<float>(
+        const float *,
+        const float *,
+        const std::size_t,
+        float *,
+        const bool,
+        const std::size_t
+    );
+    template void fastSinCos<float>(
+        const float,
+        float &,
+        float &
+    );
+    template void fastSinCos<float>(
+        const float *,
+        const std::size_t,
+        float *,
+        float *
+    );
+    template float fastAtan2<float>(
+        const float,
+        const float
+    );
+    template void fastAtan2<float>(
+        const float *,
+        const float *,
+        const std::size_t,
+        float *
+    );
+    template class conn::BasicLocalFrame<float>;
+
+    template conn::BasicLocalPoint<double> segmentPointAt<double>(
+        const conn::Segment &,
+        const double
+    );
+    template std::size_t fillPoints<double>(
+        const conn::Path &,
+        conn::BasicLocalPoint<double> *
+    );
+    template std::size_t projectPath<double>(
+        const conn::Path &,
+        const conn::BasicGeoPoint<double>,
+        double *,
+        double *,
+        const std::size_t,
+        const bool
+    );
+    template std::size_t projectPath<double>(
+        const conn::Path &,
+        const conn::BasicLocalFrame<double> &,
+        double *,
+        double *,
+        const std::size_t
+    );
+    template std::size_t fillPoints<double>(
+        const conn::TransformedPath &,
+        conn::BasicLocalPoint<double> *
+    );
+    template std::size_t projectPath<double>(
+        const conn::TransformedPath &,
+        const conn::BasicGeoPoint<double>,
+        double *,
+        double *,
+        const std::size_t,
+        const bool
+    );
+    template std::size_t projectPath<double>(
+        const conn::TransformedPath &,
+        const conn::BasicLocalFrame<double> &,
+        double *,
+        double *,
+        const std::size_t
+    );
+
+    template conn::BasicLocalPoint<float> segmentPointAt<float>(
+        const conn::Segment &,
+        const float
+    );
+    template std::size_t fillPoints<float>(
+        const conn::Path &,
+        conn::BasicLocalPoint<float> *
+    );
+    template std::size_t projectPath<float>(
+        const conn::Path &,
+        const conn::BasicGeoPoint<float>,
+        float *,
+        float *,
+        const std::size_t,
+        const bool
+    );
+    template std::size_t projectPath<float>(
+        const conn::Path &,
+        const conn::BasicLocalFrame<float> &,
+        float *,
+        float *,
+        const std::size_t
+    );
+    template std::size_t fillPoints<float>(
+        const conn::TransformedPath &,
+        conn::BasicLocalPoint<float> *
+    );
+    template std::size_t projectPath<float>(
+        const conn::TransformedPath &,
+        const conn::BasicGeoPoint<float>,
+        float *,
+        float *,
+        const std::size_t,
+        const bool
+    );
+    template std::size_t projectPath<float>(
+        const conn::TransformedPath &,
+        const conn::BasicLocalFrame<float> &,
+        float *,
+        float *,
+        const std::size_t
+    );
+}
@@ -0,0 +1,688 @@
+#if !defined(CONNSAILLIB_FORMAT_HH)
+#define CONNSAILLIB_FORMAT_HH
+
+/// \file conn_format.hh
+/// \author Egor Starobinskii
+/// \date 12 Oct 2018
+/// \brief Text formats of ConnSailLib
+/// \details Formatting and parsing of coordinates in character buffers 
+/// and their std::string forms
+
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <cmath>
+
+#include "conn_core.hh"
+
+/// \addtogroup ConnNamespace
+/// \{
+
+namespace conn{
+
+    /// \defgroup FormatFunctions Format Functions
+    /// \brief Functions formatting and parsing coordinates as text
+    /// \details Group of functions that write coordinates to character 
+    /// buffers and read them back without allocations or locales, and 
+    /// their std::string forms
+    /// \{
+
+    /// \struct FormatResult
+    /// \brief Result of formatting into a buffer
+    /// \details Result of the format functions, the same as 
+    /// std::to_chars_result of C++17
+    struct FormatResult{
+        /// \brief Pointer past the last written character, or the end of the 
+        /// buffer if it is too small
+        char *pointer;
+
+        /// \brief Error code, value-initialized on success
+        std::errc error;
+    };
+
+    /// \struct ParseResult
+    /// \brief Result of parsing a buffer
+    /// \details Result of the parse functions, the same as 
+    /// std::from_chars_result of C++17
+    struct ParseResult{
+        /// \brief Pointer past the last parsed character, or the start of the 
+        /// buffer if nothing was parsed
+        const char *pointer;
+
+        /// \brief Error code, value-initialized on success
+        std::errc error;
+    };
+
+    /// \brief Buffer size for a GPS coordinate
+    /// \details Number of characters that is always enough for 
+    /// formatGPSCoordinate() with a hemisphere and the largest precision
+    constexpr std::size_t gpsCoordinateBufferSize = 64;
+
+    /// \brief Buffer size for a GPS point
+    /// \details Number of characters that is always enough for 
+    /// formatGPSPoint() with the largest precision
+    constexpr std::size_t gpsPointBufferSize = 2 * gpsCoordinateBufferSize;
+
+    /// \brief Largest precision of seconds
+    /// \details Largest number of decimal places of seconds accepted by the 
+    /// format functions
+    constexpr int maximumSecondsPrecision = 9;
+
+    /// \fn FormatResult formatText(char *first, char *last, const char 
+    /// *text);
+    /// \brief Copies a text into a buffer
+    /// \details This function copies a null-terminated text without the null 
+    /// character into a buffer
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param text Text to copy
+    /// \return Pointer past the copied text and an error code
+    INLINE conn::FormatResult formatText(
+        char *first,
+        char *last,
+        const char *text
+    ){
+        while('\0' != *text){
+            if(first == last){
+                return conn::FormatResult{last, std::errc::value_too_large};
+            }
+
+            *first = *text;
+            ++first;
+            ++text;
+        }
+
+        return conn::FormatResult{first, std::errc()};
+    }
+
+    /// \fn FormatResult formatInteger(char *first, char *last, const long 
+    /// long value, const int minimumDigits = 1);
+    /// \brief Writes an integer into a buffer
+    /// \details This function writes decimal digits of an integer into a 
+    /// buffer, padding them with leading zeros up to \p minimumDigits
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param value Value to write
+    /// \param minimumDigits Optional. Smallest number of digits. One by 
+    /// default
+    /// \return Pointer past the written digits and an error code
+    INLINE conn::FormatResult formatInteger(
+        char *first,
+        char *last,
+        const long long value,
+        const int minimumDigits = 1
+    ){
+        char digits[24];
+        int numberOfDigits = 0;
+
+        unsigned long long magnitude = value < 0
+            ? 0ULL - static_cast<unsigned long long>(value)
+            : static_cast<unsigned long long>(value);
+
+        do{
+            digits[numberOfDigits] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+            ++numberOfDigits;
+        }while(0 != magnitude || numberOfDigits < minimumDigits);
+
+        if(last - first < numberOfDigits + (value < 0 ? 1 : 0)){
+            return conn::FormatResult{last, std::errc::value_too_large};
+        }
+
+        if(value < 0){
+            *first = '-';
+            ++first;
+        }
+
+        while(0 < numberOfDigits){
+            --numberOfDigits;
+            *first = digits[numberOfDigits];
+            ++first;
+        }
+
+        return conn::FormatResult{first, std::errc()};
+    }
+
+    /// \fn FormatResult formatGPSCoordinate(char *first, char *last, const 
+    /// DMS coordinate, const int precision = 0);
+    /// \brief Writes GPS coordinate into a buffer
+    /// \details This function writes GPS coordinate into a buffer without 
+    /// allocations, like std::to_chars does. With zero precision the text is 
+    /// the same as stringFromGPSCoordinate() gives, otherwise seconds get 
+    /// \p precision decimal places (truncated, as the other parts are), see 
+    /// fractionalDMSFromDegrees(). The text is not null-terminated
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param coordinate Value to write
+    /// \param precision Optional. Number of decimal places of seconds from 0 
+    /// to maximumSecondsPrecision. Zero by default
+    /// \return Pointer past the written text and an error code
+    INLINE conn::FormatResult formatGPSCoordinate(
+        char *first,
+        char *last,
+        const conn::DMS coordinate,
+        const int precision = 0
+    ){
+        if(precision < 0 || conn::maximumSecondsPrecision < precision){
+            return conn::FormatResult{last, std::errc::invalid_argument};
+        }
+
+        long long scale = 1;
+
+        for(int i = 0; i < precision; ++i){
+            scale *= 10;
+        }
+
+        const long long seconds = static_cast<long long>(
+            coordinate.seconds * scale
+        );
+
+        conn::FormatResult result = conn::formatInteger(
+            first,
+            last,
+            static_cast<long long>(static_cast<int>(coordinate.degrees))
+        );
+
+        if(std::errc() == result.error){
+            result = conn::formatText(result.pointer, last, "º ");
+        }
+
+        if(std::errc() == result.error){
+            result = conn::formatInteger(
+                result.pointer,
+                last,
+                static_cast<long long>(static_cast<int>(coordinate.minutes))
+            );
+        }
+
+        if(std::errc() == result.error){
+            result = conn::formatText(result.pointer, last, "' ");
+        }
+
+        if(std::errc() == result.error){
+            if(seconds < 0 && seconds > -scale){
+                result = conn::formatText(result.pointer, last, "-");
+            }
+        }
+
+        if(std::errc() == result.error){
+            result = conn::formatInteger(result.pointer, last, seconds / scale);
+        }
+
+        if(std::errc() == result.error && 0 < precision){
+            result = conn::formatText(result.pointer, last, ".");
+
+            if(std::errc() == result.error){
+                result = conn::formatInteger(
+                    result.pointer,
+                    last,
+                    std::abs(seconds % scale),
+                    precision
+                );
+            }
+        }
+
+        if(std::errc() == result.error){
+            result = conn::formatText(result.pointer, last, "\"");
+        }
+
+        return result;
+    }
+
+    /// \fn FormatResult formatGPSCoordinate(char *first, char *last, const 
+    /// DMS coordinate, const bool itIsLatitude, const int precision = 0);
+    /// \brief Writes GPS coordinate with a hemisphere into a buffer
+    /// \details This function writes GPS coordinate followed by its 
+    /// hemisphere into a buffer without allocations. The hemisphere follows 
+    /// the sign of the whole value, so zero is N or E, and so is 0º 30' 0". 
+    /// With zero precision the text is the same as stringFromGPSCoordinate() 
+    /// gives
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param coordinate Value to write
+    /// \param itIsLatitude Shows if coordinate is a latitude or a longitude
+    /// \param precision Optional. Number of decimal places of seconds from 0 
+    /// to maximumSecondsPrecision. Zero by default
+    /// \return Pointer past the written text and an error code
+    INLINE conn::FormatResult formatGPSCoordinate(
+        char *first,
+        char *last,
+        const conn::DMS coordinate,
+        const bool itIsLatitude,
+        const int precision = 0
+    ){
+        const conn::FormatResult result = conn::formatGPSCoordinate(
+            first,
+            last,
+            coordinate,
+            precision
+        );
+
+        if(std::errc() != result.error){
+            return result;
+        }
+
+        const bool isNegative = coordinate.degrees < 0 || (
+            coordinate.degrees == 0 && (
+                coordinate.minutes < 0 || (
+                    coordinate.minutes == 0 && coordinate.seconds < 0
+                )
+            )
+        );
+
+        if(itIsLatitude){
+            return conn::formatText(
+                result.pointer,
+                last,
+                isNegative ? " S" : " N"
+            );
+        }
+
+        return conn::formatText(
+            result.pointer,
+            last,
+            isNegative ? " W" : " E"
+        );
+    }
+
+    /// \fn FormatResult formatGPSPoint(char *first, char *last, const 
+    /// GPSPoint point, const int precision = 0);
+    /// \brief Writes GPS point into a buffer
+    /// \details This function writes GPS point into a buffer without 
+    /// allocations. With zero precision the text is the same as 
+    /// stringFromGPSPoint() gives
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param point Value to write
+    /// \param precision Optional. Number of decimal places of seconds from 0 
+    /// to maximumSecondsPrecision. Zero by default
+    /// \return Pointer past the written text and an error code
+    INLINE conn::FormatResult formatGPSPoint(
+        char *first,
+        char *last,
+        const conn::GPSPoint point,
+        const int precision = 0
+    ){
+        conn::FormatResult result = conn::formatGPSCoordinate(
+            first,
+            last,
+            point.latitude,
+            true,
+            precision
+        );
+
+        if(std::errc() == result.error){
+            result = conn::formatText(result.pointer, last, " ");
+        }
+
+        if(std::errc() == result.error){
+            result = conn::formatGPSCoordinate(
+                result.pointer,
+                last,
+                point.longitude,
+                false,
+                precision
+            );
+        }
+
+        return result;
+    }
+
+    /// \fn const char *skipSpaces(const char *first, const char *last);
+    /// \brief Skips spaces in a buffer
+    /// \details This function skips spaces and tabs at the start of a buffer
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \return Pointer to the first other character
+    INLINE const char *skipSpaces(const char *first, const char *last){
+        while(first != last && (' ' == *first || '\t' == *first)){
+            ++first;
+        }
+
+        return first;
+    }
+
+    /// \fn ParseResult parseNumber(const char *first, const char *last, 
+    /// double &value);
+    /// \brief Parses a decimal number from a buffer
+    /// \details This function parses a number with an optional sign and 
+    /// fractional part, e.g. -12.345, without allocations or locales. Up to 
+    /// 18 digits are taken into account, the rest are skipped
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param value Parsed number
+    /// \return Pointer past the parsed number and an error code
+    INLINE conn::ParseResult parseNumber(
+        const char *first,
+        const char *last,
+        double &value
+    ){
+        const char *current = first;
+        bool isNegative = false;
+
+        if(current != last && ('-' == *current || '+' == *current)){
+            isNegative = '-' == *current;
+            ++current;
+        }
+
+        unsigned long long mantissa = 0;
+        int numberOfDigits = 0;
+        int exponent = 0;
+        bool hasDigits = false;
+
+        while(current != last && '0' <= *current && *current <= '9'){
+            if(numberOfDigits < 18){
+                mantissa = 10 * mantissa + (*current - '0');
+                numberOfDigits += 0 != mantissa ? 1 : 0;
+            }else{
+                ++exponent;
+            }
+
+            hasDigits = true;
+            ++current;
+        }
+
+        if(current != last && '.' == *current){
+            ++current;
+
+            while(current != last && '0' <= *current && *current <= '9'){
+                if(numberOfDigits < 18){
+                    mantissa = 10 * mantissa + (*current - '0');
+                    numberOfDigits += 0 != mantissa ? 1 : 0;
+                    --exponent;
+                }
+
+                hasDigits = true;
+                ++current;
+            }
+        }
+
+        if(!hasDigits){
+            return conn::ParseResult{first, std::errc::invalid_argument};
+        }
+
+        double power = 1.;
+
+        for(int i = 0; i < std::abs(exponent); ++i){
+            power *= 10.;
+        }
+
+        value = 0 > exponent ? mantissa / power : mantissa * power;
+
+        if(isNegative){
+            value = -value;
+        }
+
+        return conn::ParseResult{current, std::errc()};
+    }
+
+    /// \fn ParseResult parseSymbol(const char *first, const char *last, const 
+    /// char *symbol);
+    /// \brief Parses a symbol from a buffer
+    /// \details This function checks that a buffer starts with a 
+    /// null-terminated symbol (possibly of several bytes, as º is)
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param symbol Symbol to find
+    /// \return Pointer past the symbol and an error code
+    INLINE conn::ParseResult parseSymbol(
+        const char *first,
+        const char *last,
+        const char *symbol
+    ){
+        const char *current = first;
+
+        while('\0' != *symbol){
+            if(current == last || *current != *symbol){
+                return conn::ParseResult{first, std::errc::invalid_argument};
+            }
+
+            ++current;
+            ++symbol;
+        }
+
+        return conn::ParseResult{current, std::errc()};
+    }
+
+    /// \fn ParseResult parseGPSCoordinate(const char *first, const char 
+    /// *last, DMS &coordinate);
+    /// \brief Parses GPS coordinate from a buffer
+    /// \details This function parses GPS coordinate written by 
+    /// formatGPSCoordinate() or stringFromGPSCoordinate(), e.g. 
+    /// 41º 59' 4.25" N, without allocations. Any of º and ° is accepted for 
+    /// degrees, spaces between the parts are optional, and so are the 
+    /// fractional part of seconds and the hemisphere. A S or W coordinate 
+    /// written without a sign, e.g. 41º 59' 4" S, is negated as a whole: 
+    /// degrees, minutes and seconds. One with negative degrees is kept as it 
+    /// is, since formatGPSCoordinate() writes floored degrees, e.g. 
+    /// -42º 0' 56" S.
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param coordinate Parsed coordinate
+    /// \return Pointer past the parsed text and an error code
+    INLINE conn::ParseResult parseGPSCoordinate(
+        const char *first,
+        const char *last,
+        conn::DMS &coordinate
+    ){
+        conn::DMS parsed = conn::DMS{0., 0., 0.};
+
+        const char *number = conn::skipSpaces(first, last);
+        const bool isNegative = number != last && '-' == *number;
+
+        conn::ParseResult result = conn::parseNumber(
+            number,
+            last,
+            parsed.degrees
+        );
+
+        if(std::errc() == result.error){
+            result = conn::parseSymbol(result.pointer, last, "º");
+
+            if(std::errc() != result.error){
+                result = conn::parseSymbol(result.pointer, last, "°");
+            }
+        }
+
+        if(std::errc() == result.error){
+            result = conn::parseNumber(
+                conn::skipSpaces(result.pointer, last),
+                last,
+                parsed.minutes
+            );
+        }
+
+        if(std::errc() == result.error){
+            result = conn::parseSymbol(result.pointer, last, "'");
+        }
+
+        if(std::errc() == result.error){
+            result = conn::parseNumber(
+                conn::skipSpaces(result.pointer, last),
+                last,
+                parsed.seconds
+            );
+        }
+
+        if(std::errc() == result.error){
+            result = conn::parseSymbol(result.pointer, last, "\"");
+        }
+
+        if(std::errc() != result.error){
+            return conn::ParseResult{first, result.error};
+        }
+
+        const char *current = conn::skipSpaces(result.pointer, last);
+
+        if(current != last){
+            const char hemisphere = *current;
+
+            if('N' == hemisphere || 'E' == hemisphere){
+                result.pointer = current + 1;
+            }else if('S' == hemisphere || 'W' == hemisphere){
+                result.pointer = current + 1;
+
+                if(!isNegative){
+                    parsed.degrees = -parsed.degrees;
+                    parsed.minutes = -parsed.minutes;
+                    parsed.seconds = -parsed.seconds;
+                }
+            }
+        }
+
+        coordinate = parsed;
+
+        return result;
+    }
+
+    /// \fn ParseResult parseGPSPoint(const char *first, const char *last, 
+    /// GPSPoint &point);
+    /// \brief Parses GPS point from a buffer
+    /// \details This function parses GPS point written by formatGPSPoint() or 
+    /// stringFromGPSPoint(): latitude and longitude separated by spaces, see 
+    /// parseGPSCoordinate()
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param point Parsed point
+    /// \return Pointer past the parsed text and an error code
+    INLINE conn::ParseResult parseGPSPoint(
+        const char *first,
+        const char *last,
+        conn::GPSPoint &point
+    ){
+        conn::GPSPoint parsed;
+
+        conn::ParseResult result = conn::parseGPSCoordinate(
+            first,
+            last,
+            parsed.latitude
+        );
+
+        if(std::errc() == result.error){
+            result = conn::parseGPSCoordinate(
+                result.pointer,
+                last,
+                parsed.longitude
+            );
+        }
+
+        if(std::errc() != result.error){
+            return conn::ParseResult{first, result.error};
+        }
+
+        point = parsed;
+
+        return result;
+    }
+
+    /// \fn std::string stringFromGPSCoordinate(const DMS coordinate);
+    /// \brief Converts GPS coordinate to a string
+    /// \details This function converts GPS coordinate to a string
+    /// \param coordinate Value to convert
+    /// \return String representation of a GPS coordinate
+    INLINE std::string stringFromGPSCoordinate(const conn::DMS coordinate){
+        char buffer[conn::gpsCoordinateBufferSize];
+
+        const conn::FormatResult result = conn::formatGPSCoordinate(
+            buffer,
+            buffer + conn::gpsCoordinateBufferSize,
+            coordinate
+        );
+
+        return std::string(buffer, result.pointer);
+    }
+
+    /// \fn std::string stringFromGPSCoordinate(const std::vector<double> 
+    /// &coordinate);
+    /// \brief Converts GPS coordinate to a string
+    /// \details This function converts GPS coordinate to a string
+    /// \param coordinate Value to convert
+    /// \return String representation of a GPS coordinate
+    /// \exception std::runtime_error If \p coordinate is not an appropriate 
+    /// type
+    INLINE std::string stringFromGPSCoordinate(
+        const std::vector<double> &coordinate
+    ){
+        return conn::stringFromGPSCoordinate(conn::dmsFromVector(coordinate));
+    }
+
+    /// \fn std::string stringFromGPSCoordinate(const DMS coordinate, const 
+    /// bool itIsLatitude);
+    /// \brief Converts GPS coordinate to a string
+    /// \details This function converts GPS coordinate to a string
+    /// \param coordinate Value to convert
+    /// \param itIsLatitude Shows if coordinate is a latitude or a longitude
+    /// \return String representation of a GPS coordinate
+    INLINE std::string stringFromGPSCoordinate(
+        const conn::DMS coordinate,
+        const bool itIsLatitude
+    ){
+        char buffer[conn::gpsCoordinateBufferSize];
+
+        const conn::FormatResult result = conn::formatGPSCoordinate(
+            buffer,
+            buffer + conn::gpsCoordinateBufferSize,
+            coordinate,
+            itIsLatitude
+        );
+
+        return std::string(buffer, result.pointer);
+    }
+
+    /// \fn std::string stringFromGPSCoordinate(const std::vector<double> 
+    /// &coordinate, const bool itIsLatitude);
+    /// \brief Converts GPS coordinate to a string
+    /// \details This function converts GPS coordinate to a string
+    /// \param coordinate Value to convert
+    /// \param itIsLatitude Shows if coordinate is a latitude or a longitude
+    /// \return String representation of a GPS coordinate
+    /// \exception std::runtime_error If \p coordinate is not an appropriate 
+    /// type
+    INLINE std::string stringFromGPSCoordinate(
+        const std::vector<double> &coordinate,
+        const bool itIsLatitude
+    ){
+        return conn::stringFromGPSCoordinate(
+            conn::dmsFromVector(coordinate),
+            itIsLatitude
+        );
+    }
+
+    /// \fn std::string stringFromGPSPoint(const GPSPoint point);
+    /// \brief Converts GPS point to a string
+    /// \details This function converts GPS point to a string
+    /// \param point Value to convert
+    /// \return String representation of a GPS point
+    INLINE std::string stringFromGPSPoint(const conn::GPSPoint point){
+        char buffer[conn::gpsPointBufferSize];
+
+        const conn::FormatResult result = conn::formatGPSPoint(
+            buffer,
+            buffer + conn::gpsPointBufferSize,
+            point
+        );
+
+        return std::string(buffer, result.pointer);
+    }
+
+    /// \fn std::string stringFromGPSPoint(const 
+    /// std::vector< std::vector<double> > &point);
+    /// \brief Converts GPS point to a string
+    /// \details This function converts GPS point to a string
+    /// \param point Value to convert
+    /// \return String representation of a GPS point
+    /// \exception std::runtime_error If \p point is not an appropriate 
+    /// type
+    INLINE std::string stringFromGPSPoint(
+        const std::vector< std::vector<double> > &point
+    ){
+        return conn::stringFromGPSPoint(conn::gpsPointFromVector(point));
+    }
+
+    /// \} End of FormatFunctions Group
+}
+
+/// \} End of Main Group
+
+#endif
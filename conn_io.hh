@@ -0,0 +1,1414 @@
+#if !defined(CONNSAILLIB_IO_HH)
+#define CONNSAILLIB_IO_HH
+
+/// \file conn_io.hh
+/// \author Egor Starobinskii
+/// \date 12 Oct 2018
+/// \brief Input and output of ConnSailLib
+/// \details Printing, waypoint files and export of paths to GPX, GeoJSON 
+/// and NMEA streams
+
+/// \def CONN_NO_MMAP
+/// \brief If defined, WaypointFile reads files instead of mapping them
+/// \details Not defined by default. Define it before including the lib to 
+/// read waypoint files to memory at once even where mmap is available.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <cmath>
+
+#include "conn_core.hh"
+#include "conn_path.hh"
+#include "conn_format.hh"
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(CONN_NO_MMAP)
+    #define CONN_HAS_MMAP
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/// \addtogroup ConnNamespace
+/// \{
+
+namespace conn{
+
+    /// \defgroup InterfaceFunctions Interface Functions
+    /// \brief Functions printing and styling incoming data
+    /// \details Group of functions that allow to print data and style it
+    /// \{
+
+    /// \fn void printGPSCoordinate(const DMS coordinate);
+    /// \brief Prints GPS coordinate to stdout
+    /// \details This function prints GPS coordinate to stdout
+    /// \param coordinate Value to print
+    INLINE void printGPSCoordinate(const conn::DMS coordinate){
+        char buffer[conn::gpsCoordinateBufferSize];
+
+        const conn::FormatResult result = conn::formatGPSCoordinate(
+            buffer,
+            buffer + conn::gpsCoordinateBufferSize,
+            coordinate
+        );
+
+        std::cout.write(buffer, result.pointer - buffer).put('\n');
+    }
+
+    /// \fn void printGPSCoordinate(const std::vector<double> &coordinate);
+    /// \brief Prints GPS coordinate to stdout
+    /// \details This function prints GPS coordinate to stdout
+    /// \param coordinate Value to print
+    INLINE void printGPSCoordinate(
+        const std::vector<double> &coordinate
+    ){
+        conn::printGPSCoordinate(conn::dmsFromVector(coordinate));
+    }
+
+    /// \fn void printGPSCoordinate(const DMS coordinate, const bool 
+    /// itIsLatitude);
+    /// \brief Prints GPS coordinate to stdout
+    /// \details This function prints GPS coordinate to stdout
+    /// \param coordinate Value to print
+    /// \param itIsLatitude Shows if coordinate is a latitude or a longitude
+    INLINE void printGPSCoordinate(
+        const conn::DMS coordinate,
+        const bool itIsLatitude
+    ){
+        char buffer[conn::gpsCoordinateBufferSize];
+
+        const conn::FormatResult result = conn::formatGPSCoordinate(
+            buffer,
+            buffer + conn::gpsCoordinateBufferSize,
+            coordinate,
+            itIsLatitude
+        );
+
+        std::cout.write(buffer, result.pointer - buffer).put('\n');
+    }
+
+    /// \fn void printGPSCoordinate(const std::vector<double> &coordinate, 
+    /// const bool itIsLatitude);
+    /// \brief Prints GPS coordinate to stdout
+    /// \details This function prints GPS coordinate to stdout
+    /// \param coordinate Value to print
+    /// \param itIsLatitude Shows if coordinate is a latitude or a longitude
+    INLINE void printGPSCoordinate(
+        const std::vector<double> &coordinate,
+        const bool itIsLatitude
+    ){
+        conn::printGPSCoordinate(conn::dmsFromVector(coordinate), itIsLatitude);
+    }
+
+    /// \fn void printGPSPoint(const GPSPoint point);
+    /// \brief Prints GPS point to stdout
+    /// \details This function prints GPS point to stdout
+    /// \param point Value to print
+    INLINE void printGPSPoint(const conn::GPSPoint point){
+        char buffer[conn::gpsPointBufferSize];
+
+        const conn::FormatResult result = conn::formatGPSPoint(
+            buffer,
+            buffer + conn::gpsPointBufferSize,
+            point
+        );
+
+        std::cout.write(buffer, result.pointer - buffer).put('\n');
+    }
+
+    /// \fn void printGPSPoint(const std::vector< std::vector<double> > &point);
+    /// \brief Prints GPS point to stdout
+    /// \details This function prints GPS point to stdout
+    /// \param point Value to print
+    INLINE void printGPSPoint(
+        const std::vector< std::vector<double> > &point
+    ){
+        conn::printGPSPoint(conn::gpsPointFromVector(point));
+    }
+
+    /// \} End of InterfaceFunctions Group
+
+    /// \defgroup StorageFunctions Storage Functions
+    /// \brief Functions storing waypoints in binary files
+    /// \details Group of functions and classes that write waypoints to a 
+    /// compact binary file and read them back without parsing. A file 
+    /// starts with a WaypointFileHeader followed by WaypointRecord values, 
+    /// both in the byte order of the machine that wrote the file
+    /// \{
+
+    /// \brief Signature of a waypoint file
+    /// \details First bytes of every waypoint file
+    constexpr char waypointFileMagic[8] = {
+        'C',
+        'O',
+        'N',
+        'N',
+        'W',
+        'P',
+        'T',
+        0
+    };
+
+    /// \brief Version of a waypoint file
+    /// \details Version of the layout written by writeWaypointFile()
+    constexpr std::uint16_t waypointFileVersion = 1;
+
+    /// \brief Byte order mark of a waypoint file
+    /// \details Value that is read back differently on a machine with 
+    /// another byte order
+    constexpr std::uint32_t waypointFileByteOrder = 0x01020304;
+
+    /// \brief Scale of waypoint coordinates
+    /// \details Number of fixed-point units in one degree. A unit is 
+    /// 1.1 cm of latitude or less
+    constexpr double waypointScale = 1e7;
+
+    /// \enum WaypointShape
+    /// \brief Shape of a stored path
+    /// \details Track function that generated the waypoints, see 
+    /// TrackFunctions group
+    enum class WaypointShape : std::uint16_t{
+        unknown = 0,
+        line = 1,
+        rectangle = 2,
+        square = 3,
+        spiral = 4,
+        sector = 5,
+        circle = 6,
+        squiggle = 7,
+        letterPi = 8
+    };
+
+    /// \struct WaypointFileHeader
+    /// \brief Header of a waypoint file
+    /// \details Fixed-size header of 64 bytes in front of the waypoints
+    struct WaypointFileHeader{
+        /// \brief Signature, see waypointFileMagic
+        char magic[8];
+
+        /// \brief Version, see waypointFileVersion
+        std::uint16_t version;
+
+        /// \brief Shape of the path
+        conn::WaypointShape shape;
+
+        /// \brief Byte order mark, see waypointFileByteOrder
+        std::uint32_t byteOrder;
+
+        /// \brief Number of waypoints following the header
+        std::uint64_t numberOfWaypoints;
+
+        /// \brief Latitude of the origin (in units of waypointScale)
+        std::int32_t originLatitude;
+
+        /// \brief Longitude of the origin (in units of waypointScale)
+        std::int32_t originLongitude;
+
+        /// \brief Parameters of the shape, e.g. its lengths and angles as 
+        /// they were passed to the track function. Unused ones are zero
+        double parameters[4];
+    };
+
+    static_assert(
+        64 == sizeof(conn::WaypointFileHeader),
+        "Waypoint file header should have no padding."
+    );
+
+    /// \struct WaypointRecord
+    /// \brief Stored waypoint
+    /// \details Waypoint in fixed point, see waypointScale
+    struct WaypointRecord{
+        /// \brief Latitude (in units of waypointScale)
+        std::int32_t latitude;
+
+        /// \brief Longitude (in units of waypointScale)
+        std::int32_t longitude;
+    };
+
+    static_assert(
+        8 == sizeof(conn::WaypointRecord),
+        "Waypoint record should have no padding."
+    );
+
+    /// \fn std::int32_t fixedPointFromDegrees(const double income);
+    /// \brief Converts degrees to fixed point
+    /// \details This function rounds degrees to the nearest unit of 
+    /// waypointScale
+    /// \param income Value to convert
+    /// \return Converted value
+    INLINE std::int32_t fixedPointFromDegrees(const double income){
+        return static_cast<std::int32_t>(
+            std::lround(income * conn::waypointScale)
+        );
+    }
+
+    /// \fn double degreesFromFixedPoint(const std::int32_t income);
+    /// \brief Converts fixed point to degrees
+    /// \details This function converts units of waypointScale to degrees
+    /// \param income Value to convert
+    /// \return Converted value
+    INLINE constexpr double degreesFromFixedPoint(const std::int32_t income){
+        return income / conn::waypointScale;
+    }
+
+    /// \fn WaypointRecord waypointRecordFromGeoPoint(const GeoPoint point);
+    /// \brief Converts a point to a waypoint record
+    /// \details This function rounds a point to the fixed point of 
+    /// waypointScale
+    /// \param point Point to convert (in degrees)
+    /// \return Converted waypoint
+    INLINE conn::WaypointRecord waypointRecordFromGeoPoint(
+        const conn::GeoPoint point
+    ){
+        return conn::WaypointRecord{
+            conn::fixedPointFromDegrees(point.latitude),
+            conn::fixedPointFromDegrees(point.longitude)
+        };
+    }
+
+    /// \fn GeoPoint geoPointFromWaypointRecord(const WaypointRecord record);
+    /// \brief Converts a waypoint record to a point
+    /// \details This function converts a waypoint record to degrees
+    /// \param record Waypoint to convert
+    /// \return Converted point (in degrees)
+    INLINE constexpr conn::GeoPoint geoPointFromWaypointRecord(
+        const conn::WaypointRecord record
+    ){
+        return conn::GeoPoint{
+            conn::degreesFromFixedPoint(record.latitude),
+            conn::degreesFromFixedPoint(record.longitude)
+        };
+    }
+
+    /// \fn WaypointFileHeader waypointFileHeader(const GeoPoint origin, const 
+    /// WaypointShape shape = WaypointShape::unknown, const double 
+    /// firstParameter = 0., const double secondParameter = 0., const double 
+    /// thirdParameter = 0., const double fourthParameter = 0.);
+    /// \brief Creates a header of a waypoint file
+    /// \details This function fills a header of the current version. The 
+    /// number of waypoints is set by writeWaypointFile()
+    /// \param origin Origin of the path (in degrees)
+    /// \param shape Optional. Shape of the path. Unknown by default
+    /// \param firstParameter Optional. First parameter of the shape
+    /// \param secondParameter Optional. Second parameter of the shape
+    /// \param thirdParameter Optional. Third parameter of the shape
+    /// \param fourthParameter Optional. Fourth parameter of the shape
+    /// \return Header
+    INLINE conn::WaypointFileHeader waypointFileHeader(
+        const conn::GeoPoint origin,
+        const conn::WaypointShape shape = conn::WaypointShape::unknown,
+        const double firstParameter = 0.,
+        const double secondParameter = 0.,
+        const double thirdParameter = 0.,
+        const double fourthParameter = 0.
+    ){
+        conn::WaypointFileHeader header;
+
+        std::memcpy(header.magic, conn::waypointFileMagic, sizeof header.magic);
+        header.version = conn::waypointFileVersion;
+        header.shape = shape;
+        header.byteOrder = conn::waypointFileByteOrder;
+        header.numberOfWaypoints = 0;
+        header.originLatitude = conn::fixedPointFromDegrees(origin.latitude);
+        header.originLongitude = conn::fixedPointFromDegrees(origin.longitude);
+        header.parameters[0] = firstParameter;
+        header.parameters[1] = secondParameter;
+        header.parameters[2] = thirdParameter;
+        header.parameters[3] = fourthParameter;
+
+        return header;
+    }
+
+    /// \fn void failIfNotAWaypointFile(const WaypointFileHeader &header, 
+    /// const std::size_t fileSize);
+    /// \brief Fails if the header does not belong to a waypoint file
+    /// \details This function checks the signature, version and byte order 
+    /// of a header and that the file holds all its waypoints. Unlike 
+    /// TestFunctions it checks always, since the data comes from outside
+    /// \param header Header to test
+    /// \param fileSize Size of the whole file in bytes
+    /// \exception std::runtime_error If the file is not a waypoint file, has 
+    /// another version or byte order, or is truncated
+    INLINE void failIfNotAWaypointFile(
+        const conn::WaypointFileHeader &header,
+        const std::size_t fileSize
+    ){
+        CONN_PROBE(conn::Probe::validation);
+
+        if(
+            sizeof(conn::WaypointFileHeader) > fileSize
+            || 0 != std::memcmp(
+                header.magic,
+                conn::waypointFileMagic,
+                sizeof header.magic
+            )
+        ){
+            throw std::runtime_error("File is not a waypoint file.");
+        }
+
+        if(conn::waypointFileVersion != header.version){
+            throw std::runtime_error("Waypoint file version is not supported.");
+        }
+
+        if(conn::waypointFileByteOrder != header.byteOrder){
+            throw std::runtime_error(
+                "Waypoint file was written with another byte order."
+            );
+        }
+
+        const std::uint64_t numberOfWaypoints = (
+            fileSize - sizeof(conn::WaypointFileHeader)
+        ) / sizeof(conn::WaypointRecord);
+
+        if(
+            fileSize - sizeof(conn::WaypointFileHeader)
+                != numberOfWaypoints * sizeof(conn::WaypointRecord)
+            || numberOfWaypoints != header.numberOfWaypoints
+        ){
+            throw std::runtime_error("Waypoint file is truncated.");
+        }
+    }
+
+    /// \fn template<typename Function> void writeWaypointRecords(const 
+    /// std::string &fileName, WaypointFileHeader header, const std::size_t 
+    /// numberOfPoints, Function recordAt);
+    /// \brief Writes waypoint records to a binary file
+    /// \details This function writes a header and the records given by \p 
+    /// recordAt through a block of 512 records (4 KB) on the stack, so no 
+    /// memory is allocated per point. It serves writeWaypointFile()
+    /// \param fileName Path to the file, which is replaced if exists
+    /// \param header Header of the file, see waypointFileHeader()
+    /// \param numberOfPoints Number of waypoints
+    /// \param recordAt Function taking an index of a waypoint and returning 
+    /// its WaypointRecord
+    /// \exception std::runtime_error If the file cannot be written
+    template<typename Function>
+    INLINE void writeWaypointRecords(
+        const std::string &fileName,
+        conn::WaypointFileHeader header,
+        const std::size_t numberOfPoints,
+        Function recordAt
+    ){
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+
+        if(!file){
+            throw std::runtime_error("Waypoint file cannot be opened.");
+        }
+
+        header.numberOfWaypoints = numberOfPoints;
+        file.write(reinterpret_cast<const char *>(&header), sizeof header);
+
+        const std::size_t blockSize = 512;
+        conn::WaypointRecord block[blockSize];
+
+        for(std::size_t i = 0; i < numberOfPoints; i += blockSize){
+            const std::size_t count = std::min(blockSize, numberOfPoints - i);
+
+            for(std::size_t j = 0; j < count; ++j){
+                block[j] = recordAt(i + j);
+            }
+
+            file.write(
+                reinterpret_cast<const char *>(block),
+                count * sizeof(conn::WaypointRecord)
+            );
+        }
+
+        if(!file.flush()){
+            throw std::runtime_error("Waypoint file cannot be written.");
+        }
+    }
+
+    /// \fn void writeWaypointFile(const std::string &fileName, 
+    /// const WaypointFileHeader header, const double *latitudes, const 
+    /// double *longitudes, const std::size_t numberOfPoints);
+    /// \brief Writes waypoints to a binary file
+    /// \details This function writes a header and waypoints converted to 
+    /// fixed point in blocks, see writeWaypointRecords()
+    /// \param fileName Path to the file, which is replaced if exists
+    /// \param header Header of the file, see waypointFileHeader()
+    /// \param latitudes Latitudes of the waypoints (in degrees)
+    /// \param longitudes Longitudes of the waypoints (in degrees)
+    /// \param numberOfPoints Number of waypoints
+    /// \exception std::runtime_error If the file cannot be written
+    INLINE void writeWaypointFile(
+        const std::string &fileName,
+        const conn::WaypointFileHeader header,
+        const double *latitudes,
+        const double *longitudes,
+        const std::size_t numberOfPoints
+    ){
+        conn::writeWaypointRecords(
+            fileName,
+            header,
+            numberOfPoints,
+            [&](const std::size_t index){
+                return conn::WaypointRecord{
+                    conn::fixedPointFromDegrees(latitudes[index]),
+                    conn::fixedPointFromDegrees(longitudes[index])
+                };
+            }
+        );
+    }
+
+    /// \fn void writeWaypointFile(const std::string &fileName, 
+    /// const WaypointFileHeader header, const std::vector<GeoPoint> &points);
+    /// \brief Writes waypoints to a binary file
+    /// \details This function writes a header and waypoints converted to 
+    /// fixed point in blocks, see writeWaypointRecords()
+    /// \param fileName Path to the file, which is replaced if exists
+    /// \param header Header of the file, see waypointFileHeader()
+    /// \param points Waypoints (in degrees)
+    /// \exception std::runtime_error If the file cannot be written
+    INLINE void writeWaypointFile(
+        const std::string &fileName,
+        const conn::WaypointFileHeader header,
+        const std::vector<conn::GeoPoint> &points
+    ){
+        conn::writeWaypointRecords(
+            fileName,
+            header,
+            points.size(),
+            [&](const std::size_t index){
+                return conn::waypointRecordFromGeoPoint(points[index]);
+            }
+        );
+    }
+
+    /// \class WaypointFile
+    /// \brief Read-only view of a waypoint file
+    /// \details Maps a waypoint file to memory and gives access to its 
+    /// waypoints in place, so opening a file costs the same for any number 
+    /// of waypoints and they are paged in while being read. Where mmap is 
+    /// not available, or CONN_NO_MMAP is defined, the file is read to memory 
+    /// at once. The object can be moved but not copied
+    class WaypointFile{
+        public:
+            /// \brief Opens a waypoint file
+            /// \param fileName Path to the file
+            /// \exception std::runtime_error If the file cannot be read or is 
+            /// not a valid waypoint file, see failIfNotAWaypointFile()
+            explicit WaypointFile(const std::string &fileName)
+                : address(nullptr),
+                fileSize(0){
+                #if defined(CONN_HAS_MMAP)
+                    const int descriptor = ::open(fileName.c_str(), O_RDONLY);
+
+                    if(0 > descriptor){
+                        throw std::runtime_error(
+                            "Waypoint file cannot be opened."
+                        );
+                    }
+
+                    struct stat status;
+
+                    if(0 != ::fstat(descriptor, &status)){
+                        ::close(descriptor);
+
+                        throw std::runtime_error(
+                            "Waypoint file cannot be opened."
+                        );
+                    }
+
+                    this->fileSize = static_cast<std::size_t>(status.st_size);
+
+                    if(sizeof(conn::WaypointFileHeader) > this->fileSize){
+                        ::close(descriptor);
+
+                        throw std::runtime_error(
+                            "File is not a waypoint file."
+                        );
+                    }
+
+                    void *address = ::mmap(
+                        nullptr,
+                        this->fileSize,
+                        PROT_READ,
+                        MAP_PRIVATE,
+                        descriptor,
+                        0
+                    );
+                    ::close(descriptor);
+
+                    if(MAP_FAILED == address){
+                        throw std::runtime_error(
+                            "Waypoint file cannot be mapped."
+                        );
+                    }
+
+                    this->address = static_cast<const char *>(address);
+                #else
+                    std::ifstream file(
+                        fileName,
+                        std::ios::binary | std::ios::ate
+                    );
+
+                    if(!file){
+                        throw std::runtime_error(
+                            "Waypoint file cannot be opened."
+                        );
+                    }
+
+                    this->fileSize = static_cast<std::size_t>(file.tellg());
+
+                    if(sizeof(conn::WaypointFileHeader) > this->fileSize){
+                        throw std::runtime_error(
+                            "File is not a waypoint file."
+                        );
+                    }
+
+                    this->buffer.resize(
+                        (this->fileSize + sizeof(conn::WaypointRecord) - 1)
+                            / sizeof(conn::WaypointRecord)
+                    );
+                    file.seekg(0);
+                    file.read(
+                        reinterpret_cast<char *>(this->buffer.data()),
+                        this->fileSize
+                    );
+
+                    if(!file){
+                        throw std::runtime_error(
+                            "Waypoint file cannot be read."
+                        );
+                    }
+
+                    this->address = reinterpret_cast<const char *>(
+                        this->buffer.data()
+                    );
+                #endif
+
+                std::memcpy(
+                    &this->header,
+                    this->address,
+                    sizeof(conn::WaypointFileHeader)
+                );
+
+                try{
+                    conn::failIfNotAWaypointFile(this->header, this->fileSize);
+                }catch(...){
+                    this->release();
+
+                    throw;
+                }
+            }
+
+            WaypointFile(const conn::WaypointFile &) = delete;
+
+            conn::WaypointFile &operator=(const conn::WaypointFile &) = delete;
+
+            /// \brief Takes over an opened file
+            /// \param other File to take over, it is left empty
+            WaypointFile(conn::WaypointFile &&other)
+                : header(other.header),
+                address(other.address),
+                fileSize(other.fileSize),
+                buffer(std::move(other.buffer)){
+                other.address = nullptr;
+                other.fileSize = 0;
+                other.header.numberOfWaypoints = 0;
+            }
+
+            /// \brief Takes over an opened file
+            /// \param other File to take over, it is left empty
+            /// \return This file
+            conn::WaypointFile &operator=(conn::WaypointFile &&other){
+                if(this != &other){
+                    this->release();
+
+                    this->header = other.header;
+                    this->address = other.address;
+                    this->fileSize = other.fileSize;
+                    this->buffer = std::move(other.buffer);
+
+                    other.address = nullptr;
+                    other.fileSize = 0;
+                    other.header.numberOfWaypoints = 0;
+                }
+
+                return *this;
+            }
+
+            /// \brief Closes the file
+            ~WaypointFile(){
+                this->release();
+            }
+
+            /// \brief Gets the header of the file
+            /// \return Header
+            const conn::WaypointFileHeader &getHeader() const{
+                return this->header;
+            }
+
+            /// \brief Gets the origin of the path
+            /// \return Origin (in degrees)
+            conn::GeoPoint getOrigin() const{
+                return conn::GeoPoint{
+                    conn::degreesFromFixedPoint(this->header.originLatitude),
+                    conn::degreesFromFixedPoint(this->header.originLongitude)
+                };
+            }
+
+            /// \brief Gets the shape of the path
+            /// \return Shape
+            conn::WaypointShape getShape() const{
+                return this->header.shape;
+            }
+
+            /// \brief Gets the number of waypoints
+            /// \return Number of waypoints
+            std::size_t size() const{
+                return static_cast<std::size_t>(
+                    this->header.numberOfWaypoints
+                );
+            }
+
+            /// \brief Gets the waypoints in place
+            /// \return Pointer to the first waypoint, valid while the file 
+            /// is open
+            const conn::WaypointRecord *data() const{
+                return reinterpret_cast<const conn::WaypointRecord *>(
+                    this->address + sizeof(conn::WaypointFileHeader)
+                );
+            }
+
+            /// \brief Gets the first waypoint
+            /// \return Pointer to the first waypoint
+            const conn::WaypointRecord *begin() const{
+                return this->data();
+            }
+
+            /// \brief Gets the end of the waypoints
+            /// \return Pointer past the last waypoint
+            const conn::WaypointRecord *end() const{
+                return this->data() + this->size();
+            }
+
+            /// \brief Gets a waypoint
+            /// \param index Index of the waypoint, not checked
+            /// \return Waypoint
+            const conn::WaypointRecord &operator[](
+                const std::size_t index
+            ) const{
+                return this->data()[index];
+            }
+
+            /// \brief Gets a waypoint in degrees
+            /// \param index Index of the waypoint, not checked
+            /// \return Waypoint (in degrees)
+            conn::GeoPoint geoPoint(const std::size_t index) const{
+                return conn::geoPointFromWaypointRecord(this->data()[index]);
+            }
+
+            /// \brief Converts all waypoints to degrees
+            /// \param latitudes Latitudes of the waypoints, size() values
+            /// \param longitudes Longitudes of the waypoints, size() values
+            void geoPoints(double *latitudes, double *longitudes) const{
+                const conn::WaypointRecord *records = this->data();
+                const std::size_t numberOfWaypoints = this->size();
+
+                for(std::size_t i = 0; i < numberOfWaypoints; ++i){
+                    latitudes[i] = conn::degreesFromFixedPoint(
+                        records[i].latitude
+                    );
+                    longitudes[i] = conn::degreesFromFixedPoint(
+                        records[i].longitude
+                    );
+                }
+            }
+
+        private:
+            void release(){
+                #if defined(CONN_HAS_MMAP)
+                    if(nullptr != this->address){
+                        ::munmap(
+                            const_cast<char *>(this->address),
+                            this->fileSize
+                        );
+                    }
+                #endif
+
+                this->address = nullptr;
+                this->fileSize = 0;
+                this->buffer.clear();
+            }
+
+            conn::WaypointFileHeader header;
+            const char *address;
+            std::size_t fileSize;
+            std::vector<conn::WaypointRecord> buffer;
+    };
+
+    /// \} End of StorageFunctions Group
+
+    /// \defgroup ExportFunctions Export Functions
+    /// \brief Functions streaming waypoints to exchange formats
+    /// \details Group of sinks that write waypoints as GPX, NMEA or GeoJSON 
+    /// while they are generated. Every sink has the same interface: write() 
+    /// takes one point or arrays of them, finish() writes the end of the 
+    /// document. Text goes through a BufferedWriter, so a sink keeps a fixed 
+    /// amount of memory for any number of points. Use exportPath() and 
+    /// exportDestinations() to feed a sink from a path or the batch 
+    /// destination kernel
+    /// \{
+
+    /// \fn FormatResult formatDecimal(char *first, char *last, const double 
+    /// value, const int precision);
+    /// \brief Writes a number with fixed decimal places into a buffer
+    /// \details This function writes a number rounded to \p precision 
+    /// decimal places, like printf("%.*f") does but without locales and 
+    /// allocations. The text is not null-terminated
+    /// \param first Start of the buffer
+    /// \param last End of the buffer
+    /// \param value Value to write, its magnitude should be below 1e9
+    /// \param precision Number of decimal places from 0 to 
+    /// maximumSecondsPrecision
+    /// \return Pointer past the written text and an error code
+    INLINE conn::FormatResult formatDecimal(
+        char *first,
+        char *last,
+        const double value,
+        const int precision
+    ){
+        if(precision < 0 || conn::maximumSecondsPrecision < precision){
+            return conn::FormatResult{last, std::errc::invalid_argument};
+        }
+
+        long long scale = 1;
+
+        for(int i = 0; i < precision; ++i){
+            scale *= 10;
+        }
+
+        const long long scaled = std::llround(std::fabs(value) * scale);
+
+        conn::FormatResult result = conn::FormatResult{first, std::errc()};
+
+        if(value < 0 && 0 != scaled){
+            result = conn::formatText(first, last, "-");
+        }
+
+        if(std::errc() == result.error){
+            result = conn::formatInteger(result.pointer, last, scaled / scale);
+        }
+
+        if(std::errc() == result.error && 0 < precision){
+            result = conn::formatText(result.pointer, last, ".");
+
+            if(std::errc() == result.error){
+                result = conn::formatInteger(
+                    result.pointer,
+                    last,
+                    scaled % scale,
+                    precision
+                );
+            }
+        }
+
+        return result;
+    }
+
+    /// \brief Longest NMEA sentence
+    /// \details Largest number of characters in an NMEA 0183 sentence, 
+    /// including the starting $ and the ending CR LF
+    constexpr std::size_t maximumNMEALength = 82;
+
+    /// \class BufferedWriter
+    /// \brief Buffer in front of an output stream
+    /// \details Collects text in a buffer of a fixed capacity and passes it 
+    /// to a stream in large blocks. Text can be written directly into the 
+    /// buffer with reserve() and commit(). Only flush() reports errors of the 
+    /// stream. The writer can not be copied
+    class BufferedWriter{
+        public:
+            /// \brief Creates a writer
+            /// \param stream Stream to write to, it should outlive the writer
+            /// \param capacity Optional. Size of the buffer in bytes. 64 KiB 
+            /// by default
+            explicit BufferedWriter(
+                std::ostream &stream,
+                const std::size_t capacity = 65536
+            ) : stream(stream),
+                buffer(std::max<std::size_t>(capacity, 256)),
+                position(0){}
+
+            BufferedWriter(const conn::BufferedWriter &) = delete;
+
+            conn::BufferedWriter &operator=(
+                const conn::BufferedWriter &
+            ) = delete;
+
+            /// \brief Passes the rest of the text to the stream
+            ~BufferedWriter(){
+                this->pass();
+            }
+
+            /// \brief Gets space in the buffer
+            /// \details Flushes the buffer if it has less free space than 
+            /// requested
+            /// \param size Number of characters to write, not greater than 
+            /// the capacity
+            /// \return Pointer to the free space
+            char *reserve(const std::size_t size){
+                if(this->buffer.size() - this->position < size){
+                    this->pass();
+                }
+
+                return this->buffer.data() + this->position;
+            }
+
+            /// \brief Accepts text written into the reserved space
+            /// \param end Pointer past the last written character
+            void commit(const char *end){
+                this->position = end - this->buffer.data();
+            }
+
+            /// \brief Writes characters
+            /// \param data Characters to write
+            /// \param size Number of characters
+            void write(const char *data, std::size_t size){
+                while(0 < size){
+                    if(this->buffer.size() == this->position){
+                        this->pass();
+                    }
+
+                    const std::size_t count = std::min(
+                        size,
+                        this->buffer.size() - this->position
+                    );
+
+                    std::memcpy(
+                        this->buffer.data() + this->position,
+                        data,
+                        count
+                    );
+                    this->position += count;
+                    data += count;
+                    size -= count;
+                }
+            }
+
+            /// \brief Writes a null-terminated text
+            /// \param text Text to write
+            void write(const char *text){
+                this->write(text, std::strlen(text));
+            }
+
+            /// \brief Passes the buffer to the stream
+            /// \details Errors of the stream are checked only here, they 
+            /// are kept by the stream meanwhile
+            /// \exception std::runtime_error If the stream fails
+            void flush(){
+                this->pass();
+                this->stream.flush();
+
+                if(!this->stream){
+                    throw std::runtime_error("Stream cannot be written.");
+                }
+            }
+
+        private:
+            void pass(){
+                this->stream.write(this->buffer.data(), this->position);
+                this->position = 0;
+            }
+
+            std::ostream &stream;
+            std::vector<char> buffer;
+            std::size_t position;
+    };
+
+    /// \class GPXSink
+    /// \brief GPX route writer
+    /// \details Writes waypoints as points of a route in a GPX 1.1 document
+    class GPXSink{
+        public:
+            /// \brief Creates a sink and writes the start of the document
+            /// \param stream Stream to write to, it should outlive the sink
+            explicit GPXSink(std::ostream &stream)
+                : writer(stream),
+                isFinished(false){
+                this->writer.write(
+                    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                    "<gpx version=\"1.1\" creator=\"ConnSailLib\" "
+                    "xmlns=\"http://www.topografix.com/GPX/1/1\">\n"
+                    "<rte>\n"
+                );
+            }
+
+            /// \brief Finishes the document if finish() was not called
+            ~GPXSink(){
+                if(!this->isFinished){
+                    this->writer.write("</rte>\n</gpx>\n");
+                }
+            }
+
+            /// \brief Writes a waypoint
+            /// \param point Waypoint (in degrees)
+            void write(const conn::GeoPoint point){
+                char *first = this->writer.reserve(64);
+                char *last = first + 64;
+
+                conn::FormatResult result = conn::formatText(
+                    first,
+                    last,
+                    "<rtept lat=\""
+                );
+                result = conn::formatDecimal(
+                    result.pointer,
+                    last,
+                    point.latitude,
+                    7
+                );
+                result = conn::formatText(result.pointer, last, "\" lon=\"");
+                result = conn::formatDecimal(
+                    result.pointer,
+                    last,
+                    point.longitude,
+                    7
+                );
+                result = conn::formatText(result.pointer, last, "\"/>\n");
+
+                this->writer.commit(result.pointer);
+            }
+
+            /// \brief Writes waypoints
+            /// \param latitudes Latitudes of the waypoints (in degrees)
+            /// \param longitudes Longitudes of the waypoints (in degrees)
+            /// \param numberOfPoints Number of waypoints
+            void write(
+                const double *latitudes,
+                const double *longitudes,
+                const std::size_t numberOfPoints
+            ){
+                for(std::size_t i = 0; i < numberOfPoints; ++i){
+                    this->write(conn::GeoPoint{latitudes[i], longitudes[i]});
+                }
+            }
+
+            /// \brief Writes the end of the document and flushes it
+            /// \exception std::runtime_error If the stream fails
+            void finish(){
+                if(!this->isFinished){
+                    this->isFinished = true;
+                    this->writer.write("</rte>\n</gpx>\n");
+                }
+
+                this->writer.flush();
+            }
+
+        private:
+            conn::BufferedWriter writer;
+            bool isFinished;
+    };
+
+    /// \class GeoJSONSink
+    /// \brief GeoJSON line writer
+    /// \details Writes waypoints as a LineString feature of a GeoJSON 
+    /// document (RFC 7946), longitude first
+    class GeoJSONSink{
+        public:
+            /// \brief Creates a sink and writes the start of the document
+            /// \param stream Stream to write to, it should outlive the sink
+            explicit GeoJSONSink(std::ostream &stream)
+                : writer(stream),
+                numberOfPoints(0),
+                isFinished(false){
+                this->writer.write(
+                    "{\"type\":\"Feature\",\"properties\":{},"
+                    "\"geometry\":{\"type\":\"LineString\",\"coordinates\":["
+                );
+            }
+
+            /// \brief Finishes the document if finish() was not called
+            ~GeoJSONSink(){
+                if(!this->isFinished){
+                    this->writer.write("]}}\n");
+                }
+            }
+
+            /// \brief Writes a waypoint
+            /// \param point Waypoint (in degrees)
+            void write(const conn::GeoPoint point){
+                char *first = this->writer.reserve(64);
+                char *last = first + 64;
+
+                conn::FormatResult result = conn::formatText(
+                    first,
+                    last,
+                    0 == this->numberOfPoints ? "\n[" : ",\n["
+                );
+                result = conn::formatDecimal(
+                    result.pointer,
+                    last,
+                    point.longitude,
+                    7
+                );
+                result = conn::formatText(result.pointer, last, ",");
+                result = conn::formatDecimal(
+                    result.pointer,
+                    last,
+                    point.latitude,
+                    7
+                );
+                result = conn::formatText(result.pointer, last, "]");
+
+                this->writer.commit(result.pointer);
+                ++this->numberOfPoints;
+            }
+
+            /// \brief Writes waypoints
+            /// \param latitudes Latitudes of the waypoints (in degrees)
+            /// \param longitudes Longitudes of the waypoints (in degrees)
+            /// \param numberOfPoints Number of waypoints
+            void write(
+                const double *latitudes,
+                const double *longitudes,
+                const std::size_t numberOfPoints
+            ){
+                for(std::size_t i = 0; i < numberOfPoints; ++i){
+                    this->write(conn::GeoPoint{latitudes[i], longitudes[i]});
+                }
+            }
+
+            /// \brief Writes the end of the document and flushes it
+            /// \exception std::runtime_error If the stream fails
+            void finish(){
+                if(!this->isFinished){
+                    this->isFinished = true;
+                    this->writer.write("]}}\n");
+                }
+
+                this->writer.flush();
+            }
+
+        private:
+            conn::BufferedWriter writer;
+            std::size_t numberOfPoints;
+            bool isFinished;
+    };
+
+    /// \class NMEASink
+    /// \brief NMEA 0183 route writer
+    /// \details Writes a WPL sentence for each waypoint as it comes, naming 
+    /// waypoints by their numbers starting with 1. finish() adds RTE 
+    /// sentences listing all the names. The names are numbers, so the route 
+    /// does not need the waypoints to be kept
+    class NMEASink{
+        public:
+            /// \brief Creates a sink
+            /// \param stream Stream to write to, it should outlive the sink
+            /// \param routeIdentifier Optional. Identifier of the route of up 
+            /// to 16 characters without commas. "1" by default
+            explicit NMEASink(
+                std::ostream &stream,
+                const std::string &routeIdentifier = "1"
+            ) : writer(stream),
+                routeIdentifier(routeIdentifier.substr(0, 16)),
+                numberOfPoints(0),
+                isFinished(false){}
+
+            /// \brief Writes the route if finish() was not called
+            ~NMEASink(){
+                if(!this->isFinished){
+                    this->finishRoute();
+                }
+            }
+
+            /// \brief Writes a waypoint
+            /// \param point Waypoint (in degrees)
+            void write(const conn::GeoPoint point){
+                char *first = this->writer.reserve(conn::maximumNMEALength);
+                char *last = first + conn::maximumNMEALength;
+
+                conn::FormatResult result = conn::formatText(
+                    first,
+                    last,
+                    "$GPWPL,"
+                );
+                result = this->formatAngle(
+                    result.pointer,
+                    last,
+                    point.latitude,
+                    2
+                );
+                result = conn::formatText(
+                    result.pointer,
+                    last,
+                    point.latitude < 0 ? ",S," : ",N,"
+                );
+                result = this->formatAngle(
+                    result.pointer,
+                    last,
+                    point.longitude,
+                    3
+                );
+                result = conn::formatText(
+                    result.pointer,
+                    last,
+                    point.longitude < 0 ? ",W," : ",E,"
+                );
+                ++this->numberOfPoints;
+                result = conn::formatInteger(
+                    result.pointer,
+                    last,
+                    this->numberOfPoints
+                );
+
+                this->writer.commit(this->formatChecksum(first, result));
+            }
+
+            /// \brief Writes waypoints
+            /// \param latitudes Latitudes of the waypoints (in degrees)
+            /// \param longitudes Longitudes of the waypoints (in degrees)
+            /// \param numberOfPoints Number of waypoints
+            void write(
+                const double *latitudes,
+                const double *longitudes,
+                const std::size_t numberOfPoints
+            ){
+                for(std::size_t i = 0; i < numberOfPoints; ++i){
+                    this->write(conn::GeoPoint{latitudes[i], longitudes[i]});
+                }
+            }
+
+            /// \brief Writes the route and flushes the sentences
+            /// \exception std::runtime_error If the stream fails
+            void finish(){
+                if(!this->isFinished){
+                    this->finishRoute();
+                }
+
+                this->writer.flush();
+            }
+
+        private:
+            void finishRoute(){
+                this->isFinished = true;
+
+                // The number of sentences is a part of each of them, so it
+                // is counted until it fits its own length
+                std::size_t numberOfSentences = 0;
+                std::size_t count = 1;
+
+                while(count != numberOfSentences){
+                    numberOfSentences = count;
+                    count = this->writeRoute(numberOfSentences, false);
+                }
+
+                this->writeRoute(numberOfSentences, true);
+            }
+
+            conn::FormatResult formatAngle(
+                char *first,
+                char *last,
+                const double angle,
+                const int numberOfDegreeDigits
+            ){
+                const double magnitude = std::fabs(angle);
+                long long degrees = static_cast<long long>(magnitude);
+                long long minutes = std::llround(
+                    (magnitude - degrees) * 60. * 1e4
+                );
+
+                if(600000 <= minutes){
+                    ++degrees;
+                    minutes -= 600000;
+                }
+
+                conn::FormatResult result = conn::formatInteger(
+                    first,
+                    last,
+                    degrees,
+                    numberOfDegreeDigits
+                );
+                result = conn::formatInteger(
+                    result.pointer,
+                    last,
+                    minutes / 10000,
+                    2
+                );
+                result = conn::formatText(result.pointer, last, ".");
+
+                return conn::formatInteger(
+                    result.pointer,
+                    last,
+                    minutes % 10000,
+                    4
+                );
+            }
+
+            char *formatChecksum(char *first, conn::FormatResult result){
+                unsigned char checksum = 0;
+
+                for(const char *i = first + 1; i != result.pointer; ++i){
+                    checksum ^= static_cast<unsigned char>(*i);
+                }
+
+                const char *digits = "0123456789ABCDEF";
+                char *current = result.pointer;
+
+                current[0] = '*';
+                current[1] = digits[checksum >> 4];
+                current[2] = digits[checksum & 15];
+                current[3] = '\r';
+                current[4] = '\n';
+
+                return current + 5;
+            }
+
+            std::size_t writeRoute(
+                const std::size_t numberOfSentences,
+                const bool shouldWrite
+            ){
+                std::size_t sentence = 0;
+                std::size_t point = 1;
+
+                while(point <= this->numberOfPoints || 0 == sentence){
+                    ++sentence;
+
+                    char line[conn::maximumNMEALength];
+                    char *last = line + conn::maximumNMEALength - 5;
+
+                    conn::FormatResult result = conn::formatText(
+                        line,
+                        last,
+                        "$GPRTE,"
+                    );
+                    result = conn::formatInteger(
+                        result.pointer,
+                        last,
+                        numberOfSentences
+                    );
+                    result = conn::formatText(result.pointer, last, ",");
+                    result = conn::formatInteger(
+                        result.pointer,
+                        last,
+                        sentence
+                    );
+                    result = conn::formatText(result.pointer, last, ",c,");
+                    result = conn::formatText(
+                        result.pointer,
+                        last,
+                        this->routeIdentifier.c_str()
+                    );
+
+                    while(point <= this->numberOfPoints){
+                        char name[24];
+                        const std::size_t size = conn::formatInteger(
+                            name,
+                            name + sizeof name,
+                            point
+                        ).pointer - name;
+
+                        if(
+                            static_cast<std::size_t>(last - result.pointer)
+                                < size + 1
+                        ){
+                            break;
+                        }
+
+                        *result.pointer = ',';
+                        std::memcpy(result.pointer + 1, name, size);
+                        result.pointer += size + 1;
+                        ++point;
+                    }
+
+                    if(shouldWrite){
+                        char *end = this->formatChecksum(line, result);
+
+                        this->writer.write(line, end - line);
+                    }
+                }
+
+                return sentence;
+            }
+
+            conn::BufferedWriter writer;
+            std::string routeIdentifier;
+            std::size_t numberOfPoints;
+            bool isFinished;
+    };
+
+    /// \fn template<typename Sink> void exportPath(Sink &sink, const Path 
+    /// &path, const LocalFrame &frame);
+    /// \brief Writes points of a path to a sink
+    /// \details This function calculates points of a path one by one, 
+    /// including the start point, converts them with a local frame and 
+    /// writes them to a sink, so the path is never held as a list of points. 
+    /// Call finish() of the sink afterwards
+    /// \param sink Sink to write to, e.g. GPXSink
+    /// \param path Path to write
+    /// \param frame Frame of the path, see LocalFrame for its range
+    template<typename Sink>
+    INLINE void exportPath(
+        Sink &sink,
+        const conn::Path &path,
+        const conn::LocalFrame &frame
+    ){
+        sink.write(frame.geoPoint(path.start));
+
+        conn::forEachPoint(path, [&](const conn::LocalPoint &point){
+            sink.write(frame.geoPoint(point));
+        });
+    }
+
+    /// \fn template<typename Sink> void exportDestinations(Sink &sink, const 
+    /// GeoPoint point, const double *distances, const double *bearings, 
+    /// const std::size_t numberOfPoints, const bool 
+    /// shouldCalculateEarthRadius = false);
+    /// \brief Writes destination points to a sink
+    /// \details This function calculates destination points with 
+    /// destinations() in blocks on the stack and writes each block to a 
+    /// sink, so no memory is allocated for the points. Call finish() of the 
+    /// sink afterwards
+    /// \param sink Sink to write to, e.g. GPXSink
+    /// \param point Start point (in degrees)
+    /// \param distances Distances to go
+    /// \param bearings Bearings to go (in degrees)
+    /// \param numberOfPoints Number of elements in each array
+    /// \param shouldCalculateEarthRadius True if Earth radius should be 
+    /// calculated for the start point using WSG-84 model, average radius is 
+    /// used otherwise.
+    template<typename Sink>
+    INLINE void exportDestinations(
+        Sink &sink,
+        const conn::GeoPoint point,
+        const double *distances,
+        const double *bearings,
+        const std::size_t numberOfPoints,
+        const bool shouldCalculateEarthRadius = false
+    ){
+        const std::size_t blockSize = 1024;
+        double latitudes[blockSize];
+        double longitudes[blockSize];
+
+        for(std::size_t i = 0; i < numberOfPoints; i += blockSize){
+            const std::size_t count = std::min(blockSize, numberOfPoints - i);
+
+            conn::destinations(
+                point,
+                distances + i,
+                bearings + i,
+                count,
+                latitudes,
+                longitudes,
+                shouldCalculateEarthRadius
+            );
+            sink.write(latitudes, longitudes, count);
+        }
+    }
+
+    /// \} End of ExportFunctions Group
+}
+
+/// \} End of Main Group
+
+#endif
@@ -0,0 +1,6161 @@
+#if !defined(CONNSAILLIB_PATH_HH)
+#define CONNSAILLIB_PATH_HH
+
+/// \file conn_path.hh
+/// \author Egor Starobinskii
+/// \date 12 Oct 2018
+/// \brief Paths of ConnSailLib
+/// \details Segments and track functions (line(), spiral(), squiggle(), 
+/// letterPi(), ...), simplification, asynchronous planning, waypoint 
+/// index and geofences
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <cmath>
+
+#include "conn_core.hh"
+
+/// \addtogroup ConnNamespace
+/// \{
+
+namespace conn{
+
+    /// \defgroup MemoryFunctions Memory Functions
+    /// \brief Classes managing memory of temporary tracks
+    /// \details Group of classes that let lists of points and paths take 
+    /// their memory from an arena which is freed all at once, e.g. when many 
+    /// candidate tracks are built and thrown away in a loop. They play the 
+    /// role std::pmr::monotonic_buffer_resource and 
+    /// std::pmr::polymorphic_allocator play since C++17
+    /// \{
+
+    /// \class MonotonicArena
+    /// \brief Memory that is freed all at once
+    /// \details Hands out memory from large blocks by moving a pointer, 
+    /// deallocation does nothing. release() frees all blocks but the largest 
+    /// one, which is reused, so a loop that releases the arena at the end of 
+    /// each iteration stops allocating after the first few ones. An arena 
+    /// must outlive everything allocated from it and is not thread-safe
+    class MonotonicArena{
+        public:
+            /// \brief Creates an empty arena
+            /// \param blockSize Optional. Size of the first block in bytes, 
+            /// every next block is twice as large. 64 KiB by default
+            explicit MonotonicArena(const std::size_t blockSize = 65536)
+                : blockSize(std::max<std::size_t>(blockSize, 64)),
+                current(nullptr),
+                remaining(0){
+            }
+
+            MonotonicArena(const conn::MonotonicArena &) = delete;
+
+            conn::MonotonicArena &operator=(
+                const conn::MonotonicArena &
+            ) = delete;
+
+            /// \brief Frees all blocks
+            ~MonotonicArena(){
+                for(const Block &block : this->blocks){
+                    ::operator delete(block.data);
+                }
+            }
+
+            /// \brief Allocates memory
+            /// \param size Number of bytes
+            /// \param alignment Optional. Alignment, a power of two. 
+            /// Alignment of std::max_align_t by default
+            /// \return Pointer to the memory
+            /// \exception std::bad_alloc If there is not enough memory
+            void *allocate(
+                const std::size_t size,
+                const std::size_t alignment = alignof(std::max_align_t)
+            ){
+                std::size_t padding = (
+                    alignment
+                    - reinterpret_cast<std::uintptr_t>(this->current)
+                    % alignment
+                ) % alignment;
+
+                if(this->remaining < size + padding){
+                    this->addBlock(size + alignment);
+                    padding = (
+                        alignment
+                        - reinterpret_cast<std::uintptr_t>(this->current)
+                        % alignment
+                    ) % alignment;
+                }
+
+                char *pointer = this->current + padding;
+
+                this->current = pointer + size;
+                this->remaining -= size + padding;
+
+                return pointer;
+            }
+
+            /// \brief Frees all memory allocated from the arena
+            /// \details Keeps the largest block for the next allocations
+            void release(){
+                if(this->blocks.empty()){
+                    return;
+                }
+
+                for(std::size_t i = 0; i + 1 < this->blocks.size(); ++i){
+                    ::operator delete(this->blocks[i].data);
+                }
+
+                this->blocks.front() = this->blocks.back();
+                this->blocks.resize(1);
+                this->current = this->blocks.front().data;
+                this->remaining = this->blocks.front().size;
+            }
+
+            /// \brief Gets a number of bytes reserved from the system
+            /// \return Total size of the blocks
+            std::size_t getCapacity() const{
+                std::size_t capacity = 0;
+
+                for(const Block &block : this->blocks){
+                    capacity += block.size;
+                }
+
+                return capacity;
+            }
+
+        private:
+            struct Block{
+                char *data;
+                std::size_t size;
+            };
+
+            void addBlock(const std::size_t minimumSize){
+                std::size_t size = this->blockSize;
+
+                if(!this->blocks.empty()){
+                    size = 2 * this->blocks.back().size;
+                }
+
+                size = std::max(size, minimumSize);
+                this->blocks.reserve(this->blocks.size() + 1);
+                this->blocks.push_back(
+                    Block{static_cast<char*>(::operator new(size)), size}
+                );
+                this->current = this->blocks.back().data;
+                this->remaining = size;
+            }
+
+            std::size_t blockSize;
+            std::vector<Block> blocks;
+            char *current;
+            std::size_t remaining;
+    };
+
+    /// \class ArenaAllocator
+    /// \brief Allocator taking memory from an arena
+    /// \details Allocator for standard containers that takes memory from a 
+    /// MonotonicArena, or from operator new if it has no arena, so a 
+    /// container with a default constructed allocator behaves as usual. 
+    /// Containers of the track functions pass the arena of their allocator 
+    /// to their temporary paths
+    /// \tparam Type Type of the elements
+    template<typename Type>
+    class ArenaAllocator{
+        public:
+            /// \brief Type of the elements
+            typedef Type value_type;
+
+            /// \brief Creates an allocator using operator new
+            ArenaAllocator() : arena(nullptr){}
+
+            /// \brief Creates an allocator using an arena
+            /// \param arena Arena to use, operator new if it is nullptr
+            ArenaAllocator(conn::MonotonicArena *arena) : arena(arena){}
+
+            /// \brief Creates an allocator using the same arena
+            /// \param other Allocator for another type
+            template<typename OtherType>
+            ArenaAllocator(const conn::ArenaAllocator<OtherType> &other)
+                : arena(other.getArena()){
+            }
+
+            /// \brief Gets the arena
+            /// \return Arena, nullptr if operator new is used
+            conn::MonotonicArena *getArena() const{
+                return this->arena;
+            }
+
+            /// \brief Allocates memory for elements
+            /// \param count Number of elements
+            /// \return Pointer to the memory
+            /// \exception std::bad_alloc If there is not enough memory
+            Type *allocate(const std::size_t count){
+                if(this->arena == nullptr){
+                    return static_cast<Type*>(
+                        ::operator new(count * sizeof(Type))
+                    );
+                }
+
+                return static_cast<Type*>(
+                    this->arena->allocate(count * sizeof(Type), alignof(Type))
+                );
+            }
+
+            /// \brief Frees memory of elements
+            /// \details Does nothing for an arena
+            /// \param pointer Pointer returned by allocate()
+            /// \param count Number of elements
+            void deallocate(Type *pointer, const std::size_t count){
+                (void) count;
+
+                if(this->arena == nullptr){
+                    ::operator delete(pointer);
+                }
+            }
+
+        private:
+            conn::MonotonicArena *arena;
+    };
+
+    /// \fn template<typename Type, typename OtherType> bool operator==(const 
+    /// ArenaAllocator<Type> &first, const ArenaAllocator<OtherType> 
+    /// &second);
+    /// \brief Compares allocators
+    /// \details Allocators are equal if they use the same arena
+    /// \param first First allocator
+    /// \param second Second allocator
+    /// \return True if memory of one can be freed by the other
+    template<typename Type, typename OtherType>
+    INLINE bool operator==(
+        const conn::ArenaAllocator<Type> &first,
+        const conn::ArenaAllocator<OtherType> &second
+    ){
+        return first.getArena() == second.getArena();
+    }
+
+    /// \fn template<typename Type, typename OtherType> bool operator!=(const 
+    /// ArenaAllocator<Type> &first, const ArenaAllocator<OtherType> 
+    /// &second);
+    /// \brief Compares allocators
+    /// \details Allocators are equal if they use the same arena
+    /// \param first First allocator
+    /// \param second Second allocator
+    /// \return True if memory of one can not be freed by the other
+    template<typename Type, typename OtherType>
+    INLINE bool operator!=(
+        const conn::ArenaAllocator<Type> &first,
+        const conn::ArenaAllocator<OtherType> &second
+    ){
+        return first.getArena() != second.getArena();
+    }
+
+    /// \fn template<typename Allocator> MonotonicArena *arenaOf(const 
+    /// Allocator &allocator);
+    /// \brief Gets an arena of an allocator
+    /// \details This function gets nullptr for allocators other than 
+    /// ArenaAllocator
+    /// \param allocator Allocator to use
+    /// \return Arena of the allocator or nullptr
+    template<typename Allocator>
+    INLINE conn::MonotonicArena *arenaOf(const Allocator &allocator){
+        (void) allocator;
+
+        return nullptr;
+    }
+
+    /// \fn template<typename Type> MonotonicArena *arenaOf(const 
+    /// ArenaAllocator<Type> &allocator);
+    /// \brief Gets an arena of an allocator
+    /// \details This function gets the arena of an ArenaAllocator
+    /// \param allocator Allocator to use
+    /// \return Arena of the allocator or nullptr
+    template<typename Type>
+    INLINE conn::MonotonicArena *arenaOf(
+        const conn::ArenaAllocator<Type> &allocator
+    ){
+        return allocator.getArena();
+    }
+
+    /// \brief List of LocalPoint in an arena
+    /// \details List of points that may take its memory from a 
+    /// MonotonicArena, e.g. ArenaPoints points(&arena)
+    typedef std::vector<
+        conn::LocalPoint,
+        conn::ArenaAllocator<conn::LocalPoint>
+    > ArenaPoints;
+
+    /// \} End of MemoryFunctions Group
+
+    /// \defgroup SegmentFunctions Segment Functions
+    /// \brief Functions describing tracks without calculating their points
+    /// \details Group of functions that describe elementary figures of a track 
+    /// as segments and compound tracks as paths. Points of a segment are 
+    /// produced on demand, so a path takes the same memory whatever number of 
+    /// points it has. The angle is calculated from the vertical axis clockwise 
+    /// in radians.
+    /// \{
+
+    /// \enum SegmentType
+    /// \brief Type of a segment
+    /// \details Type of an elementary figure described by a segment
+    enum class SegmentType{
+        /// \brief Straight line
+        line,
+
+        /// \brief Spiral (sector if its radius does not change)
+        spiral
+    };
+
+    /// \struct Segment
+    /// \brief Elementary figure of a track
+    /// \details Elementary figure of a track that produces its points on 
+    /// demand. The start point is not a point of the segment, it is the last 
+    /// point of the previous one (a pole)
+    struct Segment{
+        /// \brief Type of the segment
+        conn::SegmentType type;
+
+        /// \brief Start point (a pole) of the segment
+        conn::LocalPoint start;
+
+        /// \brief Offset of the points, the start point for a line and the 
+        /// center for a spiral
+        conn::LocalPoint offset;
+
+        /// \brief Horizontal length of a line in meters
+        double xLength;
+
+        /// \brief Vertical length of a line in meters
+        double yLength;
+
+        /// \brief Initial radius of a spiral in meters
+        double initialRadius;
+
+        /// \brief Initial angle of a spiral in radians
+        double initialAngle;
+
+        /// \brief Finish radius of a spiral in meters
+        double finishRadius;
+
+        /// \brief Finish angle of a spiral in radians
+        double finishAngle;
+
+        /// \brief Number of points of the segment
+        std::size_t numberOfPoints;
+    };
+
+    /// \fn Segment lineSegment(const LocalPoint start, const double length, 
+    /// const double angle, const std::size_t numberOfPoints);
+    /// \brief Describes a line
+    /// \details This function describes a line as a segment
+    /// \param start Start point (a pole)
+    /// \param length Length of the line in meters
+    /// \param angle Tilt angle of the line in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Segment of the line
+    INLINE conn::Segment lineSegment(
+        const conn::LocalPoint start,
+        const double length,
+        const double angle,
+        const std::size_t numberOfPoints
+    ){
+        conn::Segment segment = conn::Segment();
+
+        segment.type = conn::SegmentType::line;
+        segment.start = start;
+        segment.offset = start;
+        segment.xLength = length * sin(angle);
+        segment.yLength = length * cos(angle);
+        segment.numberOfPoints = numberOfPoints;
+
+        return segment;
+    }
+
+    /// \fn Segment spiralSegment(const LocalPoint start, const double 
+    /// initialRadius, const double initialAngle, const double finishRadius, 
+    /// const double finishAngle, const std::size_t numberOfPoints);
+    /// \brief Describes a spiral
+    /// \details This function describes a spiral as a segment
+    /// \param start Start point (a pole)
+    /// \param initialRadius Initial radius of the spiral in meters
+    /// \param initialAngle Initial angle of the spiral in radians
+    /// \param finishRadius Finish radius of the spiral in meters
+    /// \param finishAngle Finish angle of the spiral in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Segment of the spiral
+    INLINE conn::Segment spiralSegment(
+        const conn::LocalPoint start,
+        const double initialRadius,
+        const double initialAngle,
+        const double finishRadius,
+        const double finishAngle,
+        const std::size_t numberOfPoints
+    ){
+        conn::Segment segment = conn::Segment();
+
+        segment.type = conn::SegmentType::spiral;
+        segment.start = start;
+        segment.offset = conn::LocalPoint{
+            start.x - initialRadius * sin(initialAngle),
+            start.y - initialRadius * cos(initialAngle)
+        };
+        segment.initialRadius = initialRadius;
+        segment.initialAngle = initialAngle;
+        segment.finishRadius = finishRadius;
+        segment.finishAngle = finishAngle;
+        segment.numberOfPoints = numberOfPoints;
+
+        return segment;
+    }
+
+    /// \fn BasicLocalPoint<Scalar> segmentPointAt(const Segment &segment, 
+    /// const Scalar cut);
+    /// \brief Calculates a point of a segment
+    /// \details This function calculates a point of a segment by its part. 
+    /// The calculations are done in the type of \p cut, so a float cut costs 
+    /// float trigonometry only. Its error is about 6e-8 of the distance from 
+    /// the pole plus 6e-8 of the radius times the angle in radians, e.g. 4 mm 
+    /// for a 1 km radius after ten turns.
+    /// \param segment Segment to use
+    /// \param cut Part of the segment from 0 (the start point) to 1 (the last 
+    /// point)
+    /// \return Point of the segment
+    template<typename Scalar>
+    INLINE conn::BasicLocalPoint<Scalar> segmentPointAt(
+        const conn::Segment &segment,
+        const Scalar cut
+    ){
+        const Scalar offsetX = static_cast<Scalar>(segment.offset.x);
+        const Scalar offsetY = static_cast<Scalar>(segment.offset.y);
+
+        if(conn::SegmentType::line == segment.type){
+            return conn::BasicLocalPoint<Scalar>{
+                offsetX + cut * static_cast<Scalar>(segment.xLength),
+                offsetY + cut * static_cast<Scalar>(segment.yLength)
+            };
+        }
+
+        const Scalar initialRadius = static_cast<Scalar>(segment.initialRadius);
+        const Scalar initialAngle = static_cast<Scalar>(segment.initialAngle);
+
+        const Scalar radius = initialRadius + cut * (
+            static_cast<Scalar>(segment.finishRadius) - initialRadius
+        );
+        const Scalar angle = initialAngle + cut * (
+            static_cast<Scalar>(segment.finishAngle) - initialAngle
+        );
+
+        Scalar sinAngle;
+        Scalar cosAngle;
+
+        conn::kernelSinCos(angle, sinAngle, cosAngle);
+
+        return conn::BasicLocalPoint<Scalar>{
+            offsetX + radius * sinAngle,
+            offsetY + radius * cosAngle
+        };
+    }
+
+    /// \fn BasicLocalPoint<Scalar> segmentPoint(const Segment &segment, 
+    /// const std::size_t index);
+    /// \brief Calculates a point of a segment
+    /// \details This function calculates a point of a segment by its index. 
+    /// Scalar is the floating-point type of the calculations, double by 
+    /// default
+    /// \param segment Segment to use
+    /// \param index Index of the point (from 0 to numberOfPoints - 1)
+    /// \return Point of the segment
+    template<typename Scalar = double>
+    INLINE conn::BasicLocalPoint<Scalar> segmentPoint(
+        const conn::Segment &segment,
+        const std::size_t index
+    ){
+        return conn::segmentPointAt(
+            segment,
+            static_cast<Scalar>(index + 1)
+                / static_cast<Scalar>(segment.numberOfPoints)
+        );
+    }
+
+    /// \fn LocalPoint segmentFinish(const Segment &segment);
+    /// \brief Calculates the last point of a segment
+    /// \details This function calculates the last point of a segment, it is 
+    /// the start point if the segment has no points
+    /// \param segment Segment to use
+    /// \return Last point of the segment
+    INLINE conn::LocalPoint segmentFinish(const conn::Segment &segment){
+        if(0 == segment.numberOfPoints){
+            return segment.start;
+        }
+
+        return conn::segmentPoint(segment, segment.numberOfPoints - 1);
+    }
+
+    /// \fn template<typename Function> void forEachPoint(const Segment 
+    /// &segment, Function function);
+    /// \brief Calls a function for each point of a segment
+    /// \details This function calculates points of a segment one by one and 
+    /// passes each of them to \p function
+    /// \param segment Segment to use
+    /// \param function Function to call with a LocalPoint
+    template<typename Function>
+    INLINE void forEachPoint(const conn::Segment &segment, Function function){
+        for(std::size_t i = 0; i < segment.numberOfPoints; ++i){
+            function(conn::segmentPoint(segment, i));
+        }
+    }
+
+    /// \brief List of segments of a path
+    /// \details List of segments that may take its memory from a 
+    /// MonotonicArena
+    typedef std::vector<
+        conn::Segment,
+        conn::ArenaAllocator<conn::Segment>
+    > SegmentList;
+
+    /// \class PathIterator
+    /// \brief Iterator over points of a path
+    /// \details Input iterator that calculates points of a path on demand
+    class PathIterator{
+        public:
+            /// \brief Type of the iterator
+            typedef std::input_iterator_tag iterator_category;
+
+            /// \brief Type of the points
+            typedef conn::LocalPoint value_type;
+
+            /// \brief Type of a distance between iterators
+            typedef std::ptrdiff_t difference_type;
+
+            /// \brief Type of a pointer to a point
+            typedef const conn::LocalPoint *pointer;
+
+            /// \brief Type of a reference to a point
+            typedef conn::LocalPoint reference;
+
+            /// \brief Creates an iterator pointing to a point of a path
+            /// \param segments Segments of the path
+            /// \param segmentIndex Index of the segment
+            /// \param pointIndex Index of the point in the segment
+            PathIterator(
+                const conn::SegmentList *segments,
+                const std::size_t segmentIndex,
+                const std::size_t pointIndex
+            ) : segments(segments),
+                segmentIndex(segmentIndex),
+                pointIndex(pointIndex){
+                this->skipEmptySegments();
+            }
+
+            /// \brief Calculates the current point
+            /// \return Current point
+            conn::LocalPoint operator*() const{
+                return conn::segmentPoint(
+                    (*this->segments)[this->segmentIndex],
+                    this->pointIndex
+                );
+            }
+
+            /// \brief Moves to the next point
+            /// \return This iterator
+            conn::PathIterator &operator++(){
+                ++this->pointIndex;
+
+                if(
+                    this->pointIndex
+                    >= (*this->segments)[this->segmentIndex].numberOfPoints
+                ){
+                    ++this->segmentIndex;
+                    this->pointIndex = 0;
+                    this->skipEmptySegments();
+                }
+
+                return *this;
+            }
+
+            /// \brief Moves to the next point
+            /// \return Copy of this iterator before the move
+            conn::PathIterator operator++(int){
+                conn::PathIterator iterator = *this;
+
+                ++(*this);
+
+                return iterator;
+            }
+
+            /// \brief Compares two iterators
+            /// \param other Iterator to compare with
+            /// \return True if both iterators point to the same point
+            bool operator==(const conn::PathIterator &other) const{
+                return this->segmentIndex == other.segmentIndex
+                    && this->pointIndex == other.pointIndex;
+            }
+
+            /// \brief Compares two iterators
+            /// \param other Iterator to compare with
+            /// \return True if the iterators point to different points
+            bool operator!=(const conn::PathIterator &other) const{
+                return !(*this == other);
+            }
+
+        private:
+            void skipEmptySegments(){
+                while(
+                    this->segmentIndex < this->segments->size()
+                    && 0 == (*this->segments)[this->segmentIndex].numberOfPoints
+                ){
+                    ++this->segmentIndex;
+                }
+            }
+
+            const conn::SegmentList *segments;
+            std::size_t segmentIndex;
+            std::size_t pointIndex;
+    };
+
+    /// \struct Path
+    /// \brief Compound track
+    /// \details Compound track described by a start point (a pole) and a list 
+    /// of segments, each one starts at the last point of the previous one. 
+    /// Use track functions to add segments and iterate over it to get the 
+    /// points.
+    struct Path{
+        /// \brief Start point (a pole) of the path
+        conn::LocalPoint start;
+
+        /// \brief Segments of the path
+        conn::SegmentList segments;
+
+        /// \brief Creates an empty path
+        /// \param start Start point (a pole) of the path
+        /// \param arena Optional. Arena for the segments, operator new is 
+        /// used if it is nullptr. nullptr by default
+        explicit Path(
+            const conn::LocalPoint start,
+            conn::MonotonicArena *arena = nullptr
+        ) : start(start),
+            segments(conn::ArenaAllocator<conn::Segment>(arena)){}
+
+        /// \brief Calculates the last point of the path
+        /// \return Last point of the path, the start point if it is empty
+        conn::LocalPoint finish() const{
+            if(this->segments.empty()){
+                return this->start;
+            }
+
+            return conn::segmentFinish(this->segments.back());
+        }
+
+        /// \brief Gets an iterator to the first point
+        /// \return Iterator to the first point
+        conn::PathIterator begin() const{
+            return conn::PathIterator(&this->segments, 0, 0);
+        }
+
+        /// \brief Gets an iterator past the last point
+        /// \return Iterator past the last point
+        conn::PathIterator end() const{
+            return conn::PathIterator(
+                &this->segments,
+                this->segments.size(),
+                0
+            );
+        }
+    };
+
+    /// \fn template<typename Function> void forEachPoint(const Path &path, 
+    /// Function function);
+    /// \brief Calls a function for each point of a path
+    /// \details This function calculates points of a path one by one and 
+    /// passes each of them to \p function. The start point is not passed.
+    /// \param path Path to use
+    /// \param function Function to call with a LocalPoint
+    template<typename Function>
+    INLINE void forEachPoint(const conn::Path &path, Function function){
+        for(std::size_t i = 0; i < path.segments.size(); ++i){
+            conn::forEachPoint(path.segments[i], function);
+        }
+    }
+
+    /// \fn std::size_t countPoints(const Path &path);
+    /// \brief Counts points of a path
+    /// \details This function counts points of a path without calculating 
+    /// them. The start point is not counted
+    /// \param path Path to use
+    /// \return Number of points
+    INLINE std::size_t countPoints(const conn::Path &path){
+        std::size_t numberOfPoints = 0;
+
+        for(std::size_t i = 0; i < path.segments.size(); ++i){
+            numberOfPoints += path.segments[i].numberOfPoints;
+        }
+
+        return numberOfPoints;
+    }
+
+    /// \fn std::size_t fillPoints(const Path &path, BasicLocalPoint<Scalar> 
+    /// *points);
+    /// \brief Writes points of a path to a buffer
+    /// \details This function calculates points of a path and writes them to 
+    /// a preallocated buffer. The start point is not written. The points are 
+    /// calculated in the type of the buffer, so a float buffer takes a half 
+    /// of the memory and float trigonometry only, see segmentPointAt()
+    /// \param path Path to use
+    /// \param points Buffer of at least countPoints() points
+    /// \return Number of written points
+    template<typename Scalar>
+    INLINE std::size_t fillPoints(
+        const conn::Path &path,
+        conn::BasicLocalPoint<Scalar> *points
+    ){
+        std::size_t index = 0;
+
+        for(std::size_t i = 0; i < path.segments.size(); ++i){
+            const conn::Segment &segment = path.segments[i];
+
+            for(std::size_t j = 0; j < segment.numberOfPoints; ++j){
+                points[index] = conn::segmentPoint<Scalar>(segment, j);
+                ++index;
+            }
+        }
+
+        return index;
+    }
+
+    /// \fn template<typename Scalar, typename Function> std::size_t 
+    /// forEachPointInThreads(const Path &path, const std::size_t 
+    /// numberOfThreads, const Function &function);
+    /// \brief Calls a function for each point of a path in several threads
+    /// \details This function splits points of a path into equal ranges, one 
+    /// per thread, and calls \p function with the index and the value of 
+    /// each point of a range in its thread, see runInThreads(). A range may 
+    /// start inside a segment, since any point of a segment is calculated 
+    /// in closed form, so long and short segments are shared evenly. The 
+    /// start point is not passed, indices are the same as in fillPoints(). 
+    /// Scalar is the floating-point type of the points
+    /// \param path Path to use
+    /// \param numberOfThreads Number of threads to use
+    /// \param function Function to call with a std::size_t index and a 
+    /// BasicLocalPoint<Scalar>, it should not throw
+    /// \return Number of points
+    template<typename Scalar, typename Function>
+    INLINE std::size_t forEachPointInThreads(
+        const conn::Path &path,
+        const std::size_t numberOfThreads,
+        const Function &function
+    ){
+        std::vector<std::size_t> offsets(path.segments.size() + 1, 0);
+
+        for(std::size_t i = 0; i < path.segments.size(); ++i){
+            offsets[i + 1] = offsets[i] + path.segments[i].numberOfPoints;
+        }
+
+        const std::size_t numberOfPoints = offsets.back();
+        const std::size_t numberOfRanges = std::max<std::size_t>(
+            1,
+            std::min(numberOfThreads, numberOfPoints)
+        );
+        const std::size_t rangeSize = (numberOfPoints + numberOfRanges - 1)
+            / numberOfRanges;
+
+        conn::runInThreads(numberOfRanges, [&](const std::size_t range){
+            std::size_t index = range * rangeSize;
+            const std::size_t end = std::min(index + rangeSize, numberOfPoints);
+
+            std::size_t segment = std::upper_bound(
+                offsets.begin(),
+                offsets.end(),
+                index
+            ) - offsets.begin() - 1;
+
+            while(index < end){
+                const conn::Segment &current = path.segments[segment];
+                const std::size_t last = std::min(end, offsets[segment + 1]);
+
+                for(; index < last; ++index){
+                    function(
+                        index,
+                        conn::segmentPoint<Scalar>(
+                            current,
+                            index - offsets[segment]
+                        )
+                    );
+                }
+
+                ++segment;
+            }
+        });
+
+        return numberOfPoints;
+    }
+
+    /// \fn std::size_t projectPath(const Path &path, const 
+    /// BasicGeoPoint<Scalar> origin, Scalar *latitudes, Scalar *longitudes, 
+    /// const std::size_t numberOfThreads = 1, const bool 
+    /// shouldCalculateEarthRadius = false);
+    /// \brief Calculates geographic points of a path
+    /// \details This function calculates points of a path and projects each 
+    /// of them to a point at its distance and bearing from the origin, the 
+    /// same way as destinations() does, in several threads, see 
+    /// forEachPointInThreads(). Every thread writes its own range of the 
+    /// buffers, so the result is in order and identical for any number of 
+    /// threads. The start point is not written
+    /// \param path Path to use
+    /// \param origin Geographic point of the local point (0, 0) (in degrees)
+    /// \param latitudes Buffer of at least countPoints() latitudes
+    /// \param longitudes Buffer of at least countPoints() longitudes
+    /// \param numberOfThreads Optional. Number of threads to use, one by 
+    /// default
+    /// \param shouldCalculateEarthRadius Optional. True if Earth radius 
+    /// should be calculated for the origin using WSG-84 model, average radius 
+    /// is used otherwise. False by default
+    /// \return Number of written points
+    template<typename Scalar>
+    INLINE std::size_t projectPath(
+        const conn::Path &path,
+        const conn::BasicGeoPoint<Scalar> origin,
+        Scalar *latitudes,
+        Scalar *longitudes,
+        const std::size_t numberOfThreads = 1,
+        const bool shouldCalculateEarthRadius = false
+    ){
+        Scalar radius = static_cast<Scalar>(conn::earthRadius);
+
+        if(shouldCalculateEarthRadius){
+            radius = static_cast<Scalar>(
+                conn::calculateEarthRadius(origin.latitude)
+            );
+        }
+
+        const Scalar latitude = origin.latitude * static_cast<Scalar>(conn::pi)
+            / static_cast<Scalar>(180.);
+        const Scalar sinLatitude = std::sin(latitude);
+        const Scalar cosLatitude = std::cos(latitude);
+
+        return conn::forEachPointInThreads<Scalar>(
+            path,
+            numberOfThreads,
+            [&](
+                const std::size_t index,
+                const conn::BasicLocalPoint<Scalar> point
+            ){
+                const conn::BasicGeoPoint<Scalar> next =
+                    conn::destinationByAngles(
+                        origin,
+                        sinLatitude,
+                        cosLatitude,
+                        std::sqrt(point.x * point.x + point.y * point.y)
+                            / radius,
+                        conn::kernelAtan2(point.x, point.y)
+                    );
+
+                latitudes[index] = next.latitude;
+                longitudes[index] = next.longitude;
+            }
+        );
+    }
+
+    /// \fn std::size_t projectPath(const Path &path, const 
+    /// BasicLocalFrame<Scalar> &frame, Scalar *latitudes, Scalar *longitudes, 
+    /// const std::size_t numberOfThreads = 1);
+    /// \brief Calculates geographic points of a path with a local frame
+    /// \details This function calculates points of a path and converts them 
+    /// with a local frame in several threads, see forEachPointInThreads() 
+    /// and BasicLocalFrame for its range. The result is in order and 
+    /// identical for any number of threads. The start point is not written
+    /// \param path Path to use
+    /// \param frame Frame of the path
+    /// \param latitudes Buffer of at least countPoints() latitudes
+    /// \param longitudes Buffer of at least countPoints() longitudes
+    /// \param numberOfThreads Optional. Number of threads to use, one by 
+    /// default
+    /// \return Number of written points
+    template<typename Scalar>
+    INLINE std::size_t projectPath(
+        const conn::Path &path,
+        const conn::BasicLocalFrame<Scalar> &frame,
+        Scalar *latitudes,
+        Scalar *longitudes,
+        const std::size_t numberOfThreads = 1
+    ){
+        return conn::forEachPointInThreads<Scalar>(
+            path,
+            numberOfThreads,
+            [&](
+                const std::size_t index,
+                const conn::BasicLocalPoint<Scalar> point
+            ){
+                const conn::BasicGeoPoint<Scalar> next = frame.geoPoint(point);
+
+                latitudes[index] = next.latitude;
+                longitudes[index] = next.longitude;
+            }
+        );
+    }
+
+    /// \fn double segmentLengthAt(const Segment &segment, const double cut);
+    /// \brief Calculates arc length of a part of a segment
+    /// \details This function calculates arc length of a segment from its 
+    /// start point to the given part in closed form. The arc length of an 
+    /// Archimedean spiral is found by integrating its speed over radius.
+    /// \param segment Segment to use
+    /// \param cut Part of the segment from 0 (the start point) to 1 (the last 
+    /// point)
+    /// \return Arc length in meters
+    INLINE double segmentLengthAt(
+        const conn::Segment &segment,
+        const double cut
+    ){
+        if(conn::SegmentType::line == segment.type){
+            return cut * sqrt(
+                segment.xLength * segment.xLength
+                + segment.yLength * segment.yLength
+            );
+        }
+
+        const double deltaRadius = segment.finishRadius - segment.initialRadius;
+        const double deltaAngle = segment.finishAngle - segment.initialAngle;
+        const double scale = fabs(segment.initialRadius)
+            + fabs(segment.finishRadius);
+
+        if(fabs(deltaRadius) <= 1e-9 * fabs(deltaAngle) * scale){
+            return cut * fabs(segment.initialRadius * deltaAngle);
+        }
+
+        if(fabs(deltaAngle) * scale <= 1e-9 * fabs(deltaRadius)){
+            return cut * fabs(deltaRadius);
+        }
+
+        const double c = fabs(deltaRadius / deltaAngle);
+        const double radius = segment.initialRadius + cut * deltaRadius;
+
+        const double integral = 0.5 * (
+            radius * sqrt(radius * radius + c * c)
+            + c * c * asinh(radius / c)
+        ) - 0.5 * (
+            segment.initialRadius * sqrt(
+                segment.initialRadius * segment.initialRadius + c * c
+            )
+            + c * c * asinh(segment.initialRadius / c)
+        );
+
+        return fabs(deltaAngle) / deltaRadius * integral;
+    }
+
+    /// \fn double segmentLength(const Segment &segment);
+    /// \brief Calculates arc length of a segment
+    /// \details This function calculates arc length of a segment in closed 
+    /// form
+    /// \param segment Segment to use
+    /// \return Arc length in meters
+    INLINE double segmentLength(const conn::Segment &segment){
+        return conn::segmentLengthAt(segment, 1.);
+    }
+
+    /// \fn LocalPoint segmentVelocityAt(const Segment &segment, const double 
+    /// cut);
+    /// \brief Calculates derivative of a segment
+    /// \details This function calculates derivative of a point of a segment 
+    /// by its part
+    /// \param segment Segment to use
+    /// \param cut Part of the segment from 0 (the start point) to 1 (the last 
+    /// point)
+    /// \return Derivative in meters per the whole segment
+    INLINE conn::LocalPoint segmentVelocityAt(
+        const conn::Segment &segment,
+        const double cut
+    ){
+        if(conn::SegmentType::line == segment.type){
+            return conn::LocalPoint{segment.xLength, segment.yLength};
+        }
+
+        const double deltaRadius = segment.finishRadius - segment.initialRadius;
+        const double deltaAngle = segment.finishAngle - segment.initialAngle;
+        const double radius = segment.initialRadius + cut * deltaRadius;
+        const double angle = segment.initialAngle + cut * deltaAngle;
+
+        return conn::LocalPoint{
+            deltaRadius * sin(angle) + radius * deltaAngle * cos(angle),
+            deltaRadius * cos(angle) - radius * deltaAngle * sin(angle)
+        };
+    }
+
+    /// \fn double segmentCutAt(const Segment &segment, double length);
+    /// \brief Calculates part of a segment by arc length
+    /// \details This function calculates part of a segment that is at the 
+    /// given arc length from its start point. Lines and sectors are solved 
+    /// directly, spirals take a few Newton steps over segmentLengthAt()
+    /// \param segment Segment to use
+    /// \param length Arc length in meters, it is clamped to the segment
+    /// \return Part of the segment from 0 (the start point) to 1 (the last 
+    /// point)
+    INLINE double segmentCutAt(const conn::Segment &segment, double length){
+        const double totalLength = conn::segmentLength(segment);
+
+        if(totalLength <= 0.){
+            return 0.;
+        }
+
+        length = std::min(std::max(length, 0.), totalLength);
+
+        double cut = length / totalLength;
+
+        if(
+            conn::SegmentType::line == segment.type
+            || segment.initialRadius == segment.finishRadius
+        ){
+            return cut;
+        }
+
+        for(std::size_t i = 0; i < 16; ++i){
+            const conn::LocalPoint velocity = conn::segmentVelocityAt(
+                segment,
+                cut
+            );
+            const double speed = sqrt(
+                velocity.x * velocity.x + velocity.y * velocity.y
+            );
+            const double step = (
+                conn::segmentLengthAt(segment, cut) - length
+            ) / speed;
+
+            cut = std::min(std::max(cut - step, 0.), 1.);
+
+            if(fabs(step) < 1e-14){
+                break;
+            }
+        }
+
+        return cut;
+    }
+
+    /// \fn LocalPoint segmentPosition(const Segment &segment, const double 
+    /// length);
+    /// \brief Calculates a point of a segment by arc length
+    /// \details This function calculates a point of a segment that is at the 
+    /// given arc length from its start point
+    /// \param segment Segment to use
+    /// \param length Arc length in meters, it is clamped to the segment
+    /// \return Point of the segment
+    INLINE conn::LocalPoint segmentPosition(
+        const conn::Segment &segment,
+        const double length
+    ){
+        return conn::segmentPointAt(
+            segment,
+            conn::segmentCutAt(segment, length)
+        );
+    }
+
+    /// \fn double segmentHeading(const Segment &segment, const double 
+    /// length);
+    /// \brief Calculates heading of a segment by arc length
+    /// \details This function calculates heading of a segment at the given 
+    /// arc length from its start point. The heading is calculated from the 
+    /// vertical axis clockwise in radians.
+    /// \param segment Segment to use
+    /// \param length Arc length in meters, it is clamped to the segment
+    /// \return Heading in radians
+    INLINE double segmentHeading(
+        const conn::Segment &segment,
+        const double length
+    ){
+        const conn::LocalPoint velocity = conn::segmentVelocityAt(
+            segment,
+            conn::segmentCutAt(segment, length)
+        );
+
+        return atan2(velocity.x, velocity.y);
+    }
+
+    /// \fn double segmentCurvature(const Segment &segment, const double 
+    /// length);
+    /// \brief Calculates curvature of a segment by arc length
+    /// \details This function calculates curvature of a segment at the given 
+    /// arc length from its start point. It is positive if the heading grows 
+    /// (the segment turns clockwise) and negative otherwise.
+    /// \param segment Segment to use
+    /// \param length Arc length in meters, it is clamped to the segment
+    /// \return Curvature in 1 / meters
+    INLINE double segmentCurvature(
+        const conn::Segment &segment,
+        const double length
+    ){
+        if(conn::SegmentType::line == segment.type){
+            return 0.;
+        }
+
+        const double cut = conn::segmentCutAt(segment, length);
+        const double deltaRadius = segment.finishRadius - segment.initialRadius;
+        const double deltaAngle = segment.finishAngle - segment.initialAngle;
+        const double radius = segment.initialRadius + cut * deltaRadius;
+        const double angle = segment.initialAngle + cut * deltaAngle;
+
+        const conn::LocalPoint velocity = conn::segmentVelocityAt(
+            segment,
+            cut
+        );
+        const double xAcceleration = 2. * deltaRadius * deltaAngle * cos(angle)
+            - radius * deltaAngle * deltaAngle * sin(angle);
+        const double yAcceleration = -2. * deltaRadius * deltaAngle * sin(angle)
+            - radius * deltaAngle * deltaAngle * cos(angle);
+        const double speed = sqrt(
+            velocity.x * velocity.x + velocity.y * velocity.y
+        );
+
+        if(speed <= 0.){
+            return 0.;
+        }
+
+        return (velocity.y * xAcceleration - velocity.x * yAcceleration)
+            / (speed * speed * speed);
+    }
+
+    /// \fn double nearestSegmentCut(const Segment &segment, const LocalPoint 
+    /// point);
+    /// \brief Finds the nearest point of a segment
+    /// \details This function finds part of a segment that is the nearest to 
+    /// the given point. Lines are solved directly, spirals are sampled every 
+    /// pi / 16 of their angle and then refined with Newton steps.
+    /// \param segment Segment to use
+    /// \param point Point to search for
+    /// \return Part of the segment from 0 (the start point) to 1 (the last 
+    /// point)
+    INLINE double nearestSegmentCut(
+        const conn::Segment &segment,
+        const conn::LocalPoint point
+    ){
+        if(conn::SegmentType::line == segment.type){
+            const double squaredLength = segment.xLength * segment.xLength
+                + segment.yLength * segment.yLength;
+
+            if(squaredLength <= 0.){
+                return 0.;
+            }
+
+            const double cut = (
+                (point.x - segment.offset.x) * segment.xLength
+                + (point.y - segment.offset.y) * segment.yLength
+            ) / squaredLength;
+
+            return std::min(std::max(cut, 0.), 1.);
+        }
+
+        const double deltaRadius = segment.finishRadius - segment.initialRadius;
+        const double deltaAngle = segment.finishAngle - segment.initialAngle;
+        const std::size_t numberOfSamples = 8
+            + (std::size_t) (fabs(deltaAngle) / (conn::pi / 16.));
+
+        double bestCut = 0.;
+        double bestDistance = -1.;
+
+        for(std::size_t i = 0; i <= numberOfSamples; ++i){
+            const double cut = (double) i / numberOfSamples;
+            const conn::LocalPoint next = conn::segmentPointAt(segment, cut);
+            const double distance = (next.x - point.x) * (next.x - point.x)
+                + (next.y - point.y) * (next.y - point.y);
+
+            if(bestDistance < 0. || distance < bestDistance){
+                bestCut = cut;
+                bestDistance = distance;
+            }
+        }
+
+        const double lowerCut = std::max(bestCut - 1. / numberOfSamples, 0.);
+        const double upperCut = std::min(bestCut + 1. / numberOfSamples, 1.);
+
+        double cut = bestCut;
+
+        for(std::size_t i = 0; i < 8; ++i){
+            const double radius = segment.initialRadius + cut * deltaRadius;
+            const double angle = segment.initialAngle + cut * deltaAngle;
+            const conn::LocalPoint next = conn::segmentPointAt(segment, cut);
+            const conn::LocalPoint velocity = conn::segmentVelocityAt(
+                segment,
+                cut
+            );
+            const double xAcceleration = 2. * deltaRadius * deltaAngle
+                * cos(angle) - radius * deltaAngle * deltaAngle * sin(angle);
+            const double yAcceleration = -2. * deltaRadius * deltaAngle
+                * sin(angle) - radius * deltaAngle * deltaAngle * cos(angle);
+
+            const double gradient = (next.x - point.x) * velocity.x
+                + (next.y - point.y) * velocity.y;
+            const double hessian = velocity.x * velocity.x
+                + velocity.y * velocity.y
+                + (next.x - point.x) * xAcceleration
+                + (next.y - point.y) * yAcceleration;
+
+            if(hessian <= 0.){
+                break;
+            }
+
+            const double nextCut = std::min(
+                std::max(cut - gradient / hessian, lowerCut),
+                upperCut
+            );
+
+            if(fabs(nextCut - cut) < 1e-14){
+                cut = nextCut;
+                break;
+            }
+
+            cut = nextCut;
+        }
+
+        const conn::LocalPoint next = conn::segmentPointAt(segment, cut);
+        const double distance = (next.x - point.x) * (next.x - point.x)
+            + (next.y - point.y) * (next.y - point.y);
+
+        if(distance < bestDistance){
+            return cut;
+        }
+
+        return bestCut;
+    }
+
+    /// \struct PathProjection
+    /// \brief The nearest point of a path
+    /// \details The nearest point of a path to a given point, as found by 
+    /// PathLocator
+    struct PathProjection{
+        /// \brief Index of the segment with the nearest point
+        std::size_t segmentIndex;
+
+        /// \brief Arc length of the nearest point from the start of the path
+        double length;
+
+        /// \brief The nearest point
+        conn::LocalPoint point;
+
+        /// \brief Distance to the nearest point in meters
+        double distance;
+
+        /// \brief Cross-track error in meters, positive if the given point is 
+        /// to the right of the path
+        double crossTrackError;
+    };
+
+    /// \class PathLocator
+    /// \brief Arc-length and nearest-point queries on a path
+    /// \details Closed-form view of a path. Queries by arc length find the 
+    /// segment by binary search over their lengths, and the nearest point is 
+    /// found by descending a tree of bounding boxes over the segments, so 
+    /// both take O(log n) for n segments. The path is copied, so it may be 
+    /// changed or destroyed afterwards.
+    class PathLocator{
+        public:
+            /// \brief Creates a locator for a path
+            /// \param path Path to use
+            explicit PathLocator(const conn::Path &path)
+                : start(path.start),
+                segments(path.segments.begin(), path.segments.end()){
+                this->lengths.push_back(0.);
+
+                for(std::size_t i = 0; i < this->segments.size(); ++i){
+                    this->lengths.push_back(
+                        this->lengths.back()
+                        + conn::segmentLength(this->segments[i])
+                    );
+                }
+
+                if(!this->segments.empty()){
+                    this->build(0, this->segments.size());
+                }
+            }
+
+            /// \brief Gets the arc length of the path
+            /// \return Arc length in meters
+            double length() const{
+                return this->lengths.back();
+            }
+
+            /// \brief Finds the segment at the given arc length
+            /// \param length Arc length from the start of the path in meters
+            /// \return Index of the segment
+            std::size_t segmentIndex(const double length) const{
+                const std::size_t index = std::upper_bound(
+                    this->lengths.begin() + 1,
+                    this->lengths.end(),
+                    length
+                ) - this->lengths.begin() - 1;
+
+                return std::min(index, this->segments.size() - 1);
+            }
+
+            /// \brief Calculates a point of the path by arc length
+            /// \param length Arc length from the start of the path in meters
+            /// \return Point of the path
+            conn::LocalPoint position(const double length) const{
+                if(this->segments.empty()){
+                    return this->start;
+                }
+
+                const std::size_t index = this->segmentIndex(length);
+
+                return conn::segmentPosition(
+                    this->segments[index],
+                    length - this->lengths[index]
+                );
+            }
+
+            /// \brief Calculates heading of the path by arc length
+            /// \param length Arc length from the start of the path in meters
+            /// \return Heading in radians (from the vertical axis clockwise)
+            double heading(const double length) const{
+                if(this->segments.empty()){
+                    return 0.;
+                }
+
+                const std::size_t index = this->segmentIndex(length);
+
+                return conn::segmentHeading(
+                    this->segments[index],
+                    length - this->lengths[index]
+                );
+            }
+
+            /// \brief Calculates curvature of the path by arc length
+            /// \param length Arc length from the start of the path in meters
+            /// \return Curvature in 1 / meters, positive if turning clockwise
+            double curvature(const double length) const{
+                if(this->segments.empty()){
+                    return 0.;
+                }
+
+                const std::size_t index = this->segmentIndex(length);
+
+                return conn::segmentCurvature(
+                    this->segments[index],
+                    length - this->lengths[index]
+                );
+            }
+
+            /// \brief Finds the nearest point of the path
+            /// \param point Point to search for
+            /// \return The nearest point (the start one for an empty path)
+            conn::PathProjection locate(const conn::LocalPoint point) const{
+                conn::PathProjection projection = conn::PathProjection();
+
+                projection.point = this->start;
+                projection.distance = sqrt(
+                    (point.x - this->start.x) * (point.x - this->start.x)
+                    + (point.y - this->start.y) * (point.y - this->start.y)
+                );
+
+                if(this->segments.empty()){
+                    return projection;
+                }
+
+                double bestDistance = -1.;
+                double bestCut = 0.;
+
+                this->search(
+                    0,
+                    point,
+                    projection.segmentIndex,
+                    bestCut,
+                    bestDistance
+                );
+
+                const conn::Segment &segment = this->segments[
+                    projection.segmentIndex
+                ];
+                const conn::LocalPoint velocity = conn::segmentVelocityAt(
+                    segment,
+                    bestCut
+                );
+                const double heading = atan2(velocity.x, velocity.y);
+
+                projection.point = conn::segmentPointAt(segment, bestCut);
+                projection.length = this->lengths[projection.segmentIndex]
+                    + conn::segmentLengthAt(segment, bestCut);
+                projection.distance = sqrt(bestDistance);
+                projection.crossTrackError = (point.x - projection.point.x)
+                    * cos(heading) - (point.y - projection.point.y)
+                    * sin(heading);
+
+                return projection;
+            }
+
+        private:
+            struct Node{
+                double minX;
+                double minY;
+                double maxX;
+                double maxY;
+                std::size_t first;
+                std::size_t last;
+                std::size_t left;
+                std::size_t right;
+            };
+
+            std::size_t build(const std::size_t first, const std::size_t last){
+                const std::size_t index = this->nodes.size();
+
+                this->nodes.push_back(Node());
+                this->nodes[index].first = first;
+                this->nodes[index].last = last;
+
+                if(1 == last - first){
+                    this->bound(this->segments[first], this->nodes[index]);
+
+                    return index;
+                }
+
+                const std::size_t middle = first + (last - first) / 2;
+                const std::size_t left = this->build(first, middle);
+                const std::size_t right = this->build(middle, last);
+
+                Node &node = this->nodes[index];
+
+                node.left = left;
+                node.right = right;
+                node.minX = std::min(
+                    this->nodes[left].minX,
+                    this->nodes[right].minX
+                );
+                node.minY = std::min(
+                    this->nodes[left].minY,
+                    this->nodes[right].minY
+                );
+                node.maxX = std::max(
+                    this->nodes[left].maxX,
+                    this->nodes[right].maxX
+                );
+                node.maxY = std::max(
+                    this->nodes[left].maxY,
+                    this->nodes[right].maxY
+                );
+
+                return index;
+            }
+
+            void bound(const conn::Segment &segment, Node &node) const{
+                const double deltaAngle = segment.finishAngle
+                    - segment.initialAngle;
+                const std::size_t numberOfSamples = 1
+                    + (std::size_t) (fabs(deltaAngle) / (conn::pi / 8.));
+                double margin = 0.;
+
+                if(conn::SegmentType::spiral == segment.type){
+                    const double step = fabs(deltaAngle) / numberOfSamples;
+
+                    margin = std::max(
+                        fabs(segment.initialRadius),
+                        fabs(segment.finishRadius)
+                    ) * (1. - cos(0.5 * step)) + fabs(
+                        segment.finishRadius - segment.initialRadius
+                    ) / numberOfSamples;
+                }
+
+                node.minX = node.maxX = segment.start.x;
+                node.minY = node.maxY = segment.start.y;
+
+                for(std::size_t i = 1; i <= numberOfSamples; ++i){
+                    const conn::LocalPoint point = conn::segmentPointAt(
+                        segment,
+                        (double) i / numberOfSamples
+                    );
+
+                    node.minX = std::min(node.minX, point.x);
+                    node.minY = std::min(node.minY, point.y);
+                    node.maxX = std::max(node.maxX, point.x);
+                    node.maxY = std::max(node.maxY, point.y);
+                }
+
+                node.minX -= margin;
+                node.minY -= margin;
+                node.maxX += margin;
+                node.maxY += margin;
+            }
+
+            void search(
+                const std::size_t index,
+                const conn::LocalPoint point,
+                std::size_t &bestIndex,
+                double &bestCut,
+                double &bestDistance
+            ) const{
+                const Node &node = this->nodes[index];
+
+                if(1 == node.last - node.first){
+                    const conn::Segment &segment = this->segments[node.first];
+                    const double cut = conn::nearestSegmentCut(segment, point);
+                    const conn::LocalPoint next = conn::segmentPointAt(
+                        segment,
+                        cut
+                    );
+                    const double distance = (next.x - point.x)
+                        * (next.x - point.x) + (next.y - point.y)
+                        * (next.y - point.y);
+
+                    if(bestDistance < 0. || distance < bestDistance){
+                        bestIndex = node.first;
+                        bestCut = cut;
+                        bestDistance = distance;
+                    }
+
+                    return;
+                }
+
+                const double leftDistance = this->boxDistance(
+                    this->nodes[node.left],
+                    point
+                );
+                const double rightDistance = this->boxDistance(
+                    this->nodes[node.right],
+                    point
+                );
+                const bool isLeftFirst = leftDistance <= rightDistance;
+
+                const std::size_t first = isLeftFirst ? node.left : node.right;
+                const std::size_t second = isLeftFirst ? node.right : node.left;
+                const double firstDistance = isLeftFirst
+                    ? leftDistance : rightDistance;
+                const double secondDistance = isLeftFirst
+                    ? rightDistance : leftDistance;
+
+                if(bestDistance < 0. || firstDistance < bestDistance){
+                    this->search(
+                        first,
+                        point,
+                        bestIndex,
+                        bestCut,
+                        bestDistance
+                    );
+                }
+
+                if(bestDistance < 0. || secondDistance < bestDistance){
+                    this->search(
+                        second,
+                        point,
+                        bestIndex,
+                        bestCut,
+                        bestDistance
+                    );
+                }
+            }
+
+            double boxDistance(
+                const Node &node,
+                const conn::LocalPoint point
+            ) const{
+                const double x = std::max(
+                    std::max(node.minX - point.x, point.x - node.maxX),
+                    0.
+                );
+                const double y = std::max(
+                    std::max(node.minY - point.y, point.y - node.maxY),
+                    0.
+                );
+
+                return x * x + y * y;
+            }
+
+            conn::LocalPoint start;
+            std::vector<conn::Segment> segments;
+            std::vector<double> lengths;
+            std::vector<Node> nodes;
+    };
+
+    /// \} End of SegmentFunctions Group
+
+    /// \defgroup TransformFunctions Transform Functions
+    /// \brief Functions moving paths without calculating their points again
+    /// \details Group of functions that rotate, translate, scale and flip 
+    /// paths with affine transforms. transformPath() changes the segments 
+    /// only, so it costs the same for any number of points and its result is 
+    /// a path again. TransformedPath applies any affine transform to the 
+    /// points on demand, so it is fused into fillPoints() and projectPath() 
+    /// and costs one matrix per point instead of a second pass. The angle is 
+    /// calculated from the vertical axis clockwise in radians.
+    /// \{
+
+    /// \struct Transform2D
+    /// \brief Affine transform of local points
+    /// \details Affine transform that moves a point (x, y) to the point 
+    /// (xx * x + xy * y + dx, yx * x + yy * y + dy)
+    struct Transform2D{
+        /// \brief Factor of x in the new x
+        double xx;
+
+        /// \brief Factor of y in the new x
+        double xy;
+
+        /// \brief Factor of x in the new y
+        double yx;
+
+        /// \brief Factor of y in the new y
+        double yy;
+
+        /// \brief Offset of the new x in meters
+        double dx;
+
+        /// \brief Offset of the new y in meters
+        double dy;
+    };
+
+    /// \fn Transform2D identityTransform();
+    /// \brief Describes a transform that moves nothing
+    /// \details This function describes the identity transform
+    /// \return Identity transform
+    INLINE conn::Transform2D identityTransform(){
+        return conn::Transform2D{1., 0., 0., 1., 0., 0.};
+    }
+
+    /// \fn Transform2D translationTransform(const LocalPoint offset);
+    /// \brief Describes a translation
+    /// \details This function describes a transform that moves every point 
+    /// by the same offset
+    /// \param offset Offset in meters
+    /// \return Transform of the translation
+    INLINE conn::Transform2D translationTransform(
+        const conn::LocalPoint offset
+    ){
+        return conn::Transform2D{1., 0., 0., 1., offset.x, offset.y};
+    }
+
+    /// \fn Transform2D rotationTransform(const double angle, const LocalPoint 
+    /// center = LocalPoint{0., 0.});
+    /// \brief Describes a rotation
+    /// \details This function describes a transform that rotates points 
+    /// clockwise around a center, so a segment of a track built with its 
+    /// angle increased by \p angle is the rotated segment
+    /// \param angle Angle of the rotation in radians
+    /// \param center Optional. Center of the rotation, (0, 0) by default
+    /// \return Transform of the rotation
+    INLINE conn::Transform2D rotationTransform(
+        const double angle,
+        const conn::LocalPoint center = conn::LocalPoint{0., 0.}
+    ){
+        const double sinAngle = sin(angle);
+        const double cosAngle = cos(angle);
+
+        return conn::Transform2D{
+            cosAngle,
+            sinAngle,
+            -sinAngle,
+            cosAngle,
+            center.x - cosAngle * center.x - sinAngle * center.y,
+            center.y + sinAngle * center.x - cosAngle * center.y
+        };
+    }
+
+    /// \fn Transform2D scalingTransform(const double xFactor, const double 
+    /// yFactor, const LocalPoint center = LocalPoint{0., 0.});
+    /// \brief Describes a scaling
+    /// \details This function describes a transform that scales points along 
+    /// the axes around a center. A negative factor flips the points
+    /// \param xFactor Factor of the horizontal offsets from the center
+    /// \param yFactor Factor of the vertical offsets from the center
+    /// \param center Optional. Center of the scaling, (0, 0) by default
+    /// \return Transform of the scaling
+    INLINE conn::Transform2D scalingTransform(
+        const double xFactor,
+        const double yFactor,
+        const conn::LocalPoint center = conn::LocalPoint{0., 0.}
+    ){
+        return conn::Transform2D{
+            xFactor,
+            0.,
+            0.,
+            yFactor,
+            center.x - xFactor * center.x,
+            center.y - yFactor * center.y
+        };
+    }
+
+    /// \fn Transform2D concatenateTransforms(const Transform2D &first, const 
+    /// Transform2D &second);
+    /// \brief Concatenates two transforms
+    /// \details This function multiplies matrices of two transforms, so the 
+    /// result moves a point as \p first and then \p second do
+    /// \param first Transform to apply first
+    /// \param second Transform to apply second
+    /// \return Concatenated transform
+    INLINE conn::Transform2D concatenateTransforms(
+        const conn::Transform2D &first,
+        const conn::Transform2D &second
+    ){
+        return conn::Transform2D{
+            second.xx * first.xx + second.xy * first.yx,
+            second.xx * first.xy + second.xy * first.yy,
+            second.yx * first.xx + second.yy * first.yx,
+            second.yx * first.xy + second.yy * first.yy,
+            second.xx * first.dx + second.xy * first.dy + second.dx,
+            second.yx * first.dx + second.yy * first.dy + second.dy
+        };
+    }
+
+    /// \fn BasicLocalPoint<Scalar> transformPoint(const Transform2D 
+    /// &transform, const BasicLocalPoint<Scalar> point);
+    /// \brief Transforms a point
+    /// \details This function applies an affine transform to a point. The 
+    /// calculations are done in the type of \p point
+    /// \param transform Transform to apply
+    /// \param point Point to transform
+    /// \return Transformed point
+    template<typename Scalar>
+    INLINE conn::BasicLocalPoint<Scalar> transformPoint(
+        const conn::Transform2D &transform,
+        const conn::BasicLocalPoint<Scalar> point
+    ){
+        return conn::BasicLocalPoint<Scalar>{
+            static_cast<Scalar>(transform.xx) * point.x
+                + static_cast<Scalar>(transform.xy) * point.y
+                + static_cast<Scalar>(transform.dx),
+            static_cast<Scalar>(transform.yx) * point.x
+                + static_cast<Scalar>(transform.yy) * point.y
+                + static_cast<Scalar>(transform.dy)
+        };
+    }
+
+    /// \fn bool isSimilarityTransform(const Transform2D &transform);
+    /// \brief Checks if a transform keeps shapes
+    /// \details This function checks if a transform is a similarity, i.e. a 
+    /// combination of a rotation, a translation, a uniform scaling and a 
+    /// flip, up to rounding of its matrix. A similarity moves a spiral to a 
+    /// spiral
+    /// \param transform Transform to check
+    /// \return True if the transform is a similarity
+    INLINE bool isSimilarityTransform(const conn::Transform2D &transform){
+        const double tolerance = 1e-12 * (
+            fabs(transform.xx) + fabs(transform.xy)
+            + fabs(transform.yx) + fabs(transform.yy)
+        );
+
+        const bool isRotation = fabs(transform.xx - transform.yy) <= tolerance
+            && fabs(transform.xy + transform.yx) <= tolerance;
+        const bool isFlip = fabs(transform.xx + transform.yy) <= tolerance
+            && fabs(transform.xy - transform.yx) <= tolerance;
+
+        return isRotation || isFlip;
+    }
+
+    /// \fn Segment transformSegment(const Segment &segment, const Transform2D 
+    /// &transform);
+    /// \brief Transforms a segment
+    /// \details This function transforms the description of a segment, so 
+    /// its points are not calculated. A line is moved by any transform, a 
+    /// spiral only by a similarity, see isSimilarityTransform(): its 
+    /// center is moved, its radii are scaled and its angles are turned. 
+    /// Points of the result agree with the transformed points up to 
+    /// rounding
+    /// \param segment Segment to transform
+    /// \param transform Transform to apply
+    /// \return Transformed segment
+    /// \exception std::runtime_error If the segment is a spiral and the 
+    /// transform is not a similarity
+    INLINE conn::Segment transformSegment(
+        const conn::Segment &segment,
+        const conn::Transform2D &transform
+    ){
+        conn::Segment result = segment;
+
+        result.start = conn::transformPoint(transform, segment.start);
+        result.offset = conn::transformPoint(transform, segment.offset);
+
+        if(conn::SegmentType::line == segment.type){
+            result.xLength = transform.xx * segment.xLength
+                + transform.xy * segment.yLength;
+            result.yLength = transform.yx * segment.xLength
+                + transform.yy * segment.yLength;
+
+            return result;
+        }
+
+        if(!conn::isSimilarityTransform(transform)){
+            throw std::runtime_error(
+                "Spiral can be transformed by a similarity only"
+            );
+        }
+
+        const double scale = sqrt(
+            transform.xy * transform.xy + transform.yy * transform.yy
+        );
+        const double angle = atan2(transform.xy, transform.yy);
+        const double direction =
+            transform.xx * transform.yy - transform.xy * transform.yx < 0.
+                ? -1.
+                : 1.;
+
+        result.initialRadius = scale * segment.initialRadius;
+        result.finishRadius = scale * segment.finishRadius;
+        result.initialAngle = direction * segment.initialAngle + angle;
+        result.finishAngle = direction * segment.finishAngle + angle;
+
+        return result;
+    }
+
+    /// \fn Path transformPath(const Path &path, const Transform2D &transform, 
+    /// MonotonicArena *arena = nullptr);
+    /// \brief Transforms a path
+    /// \details This function transforms the start point and each segment of 
+    /// a path, see transformSegment(). It costs the same for any number of 
+    /// points, e.g. a squiggle with another heading is the squiggle rotated 
+    /// around its start point, see rotationTransform(). Use TransformedPath 
+    /// for transforms that are not similarities
+    /// \param path Path to transform
+    /// \param transform Transform to apply
+    /// \param arena Optional. Arena for the segments of the result, operator 
+    /// new is used if it is nullptr. nullptr by default
+    /// \return Transformed path
+    /// \exception std::runtime_error If the path has a spiral and the 
+    /// transform is not a similarity
+    INLINE conn::Path transformPath(
+        const conn::Path &path,
+        const conn::Transform2D &transform,
+        conn::MonotonicArena *arena = nullptr
+    ){
+        conn::Path result(conn::transformPoint(transform, path.start), arena);
+
+        result.segments.reserve(path.segments.size());
+
+        for(std::size_t i = 0; i < path.segments.size(); ++i){
+            result.segments.push_back(
+                conn::transformSegment(path.segments[i], transform)
+            );
+        }
+
+        return result;
+    }
+
+    /// \struct TransformedPath
+    /// \brief Path with a transform applied on demand
+    /// \details Refers to a path and a transform and applies the transform to 
+    /// each point when it is calculated, so any affine transform can be used 
+    /// and nothing is copied. The path should outlive it. Concatenate 
+    /// transforms to apply several ones, see concatenateTransforms()
+    struct TransformedPath{
+        /// \brief Creates a transformed path
+        /// \param path Path to refer to
+        /// \param transform Transform to apply
+        TransformedPath(
+            const conn::Path &path,
+            const conn::Transform2D &transform
+        ) : path(&path),
+            transform(transform){}
+
+        /// \brief Path to transform
+        const conn::Path *path;
+
+        /// \brief Transform to apply
+        conn::Transform2D transform;
+    };
+
+    /// \fn template<typename Function> void forEachPoint(const 
+    /// TransformedPath &path, Function function);
+    /// \brief Calls a function for each point of a transformed path
+    /// \details This function calculates points of a path one by one, 
+    /// transforms them and passes each of them to \p function. The start 
+    /// point is not passed.
+    /// \param path Transformed path to use
+    /// \param function Function to call with a LocalPoint
+    template<typename Function>
+    INLINE void forEachPoint(
+        const conn::TransformedPath &path,
+        Function function
+    ){
+        conn::forEachPoint(*path.path, [&](const conn::LocalPoint point){
+            function(conn::transformPoint(path.transform, point));
+        });
+    }
+
+    /// \fn std::size_t countPoints(const TransformedPath &path);
+    /// \brief Counts points of a transformed path
+    /// \details This function counts points of a path without calculating 
+    /// them. The start point is not counted
+    /// \param path Transformed path to use
+    /// \return Number of points
+    INLINE std::size_t countPoints(const conn::TransformedPath &path){
+        return conn::countPoints(*path.path);
+    }
+
+    /// \fn std::size_t fillPoints(const TransformedPath &path, 
+    /// BasicLocalPoint<Scalar> *points);
+    /// \brief Writes points of a transformed path to a buffer
+    /// \details This function calculates points of a path, transforms them 
+    /// and writes them to a preallocated buffer in one pass. The start point 
+    /// is not written. The points are calculated in the type of the buffer, 
+    /// see fillPoints()
+    /// \param path Transformed path to use
+    /// \param points Buffer of at least countPoints() points
+    /// \return Number of written points
+    template<typename Scalar>
+    INLINE std::size_t fillPoints(
+        const conn::TransformedPath &path,
+        conn::BasicLocalPoint<Scalar> *points
+    ){
+        std::size_t index = 0;
+
+        for(std::size_t i = 0; i < path.path->segments.size(); ++i){
+            const conn::Segment &segment = path.path->segments[i];
+
+            for(std::size_t j = 0; j < segment.numberOfPoints; ++j){
+                points[index] = conn::transformPoint(
+                    path.transform,
+                    conn::segmentPoint<Scalar>(segment, j)
+                );
+                ++index;
+            }
+        }
+
+        return index;
+    }
+
+    /// \fn template<typename Scalar, typename Function> std::size_t 
+    /// forEachPointInThreads(const TransformedPath &path, const std::size_t 
+    /// numberOfThreads, const Function &function);
+    /// \brief Calls a function for each point of a transformed path in 
+    /// several threads
+    /// \details This function transforms points of a path and calls \p 
+    /// function with the index and the value of each of them, see 
+    /// forEachPointInThreads(). Scalar is the floating-point type of the 
+    /// points
+    /// \param path Transformed path to use
+    /// \param numberOfThreads Number of threads to use
+    /// \param function Function to call with a std::size_t index and a 
+    /// BasicLocalPoint<Scalar>, it should not throw
+    /// \return Number of points
+    template<typename Scalar, typename Function>
+    INLINE std::size_t forEachPointInThreads(
+        const conn::TransformedPath &path,
+        const std::size_t numberOfThreads,
+        const Function &function
+    ){
+        return conn::forEachPointInThreads<Scalar>(
+            *path.path,
+            numberOfThreads,
+            [&](
+                const std::size_t index,
+                const conn::BasicLocalPoint<Scalar> point
+            ){
+                function(index, conn::transformPoint(path.transform, point));
+            }
+        );
+    }
+
+    /// \fn std::size_t projectPath(const TransformedPath &path, const 
+    /// BasicGeoPoint<Scalar> origin, Scalar *latitudes, Scalar *longitudes, 
+    /// const std::size_t numberOfThreads = 1, const bool 
+    /// shouldCalculateEarthRadius = false);
+    /// \brief Calculates geographic points of a transformed path
+    /// \details This function calculates points of a path, transforms them 
+    /// and projects each of them to a point at its distance and bearing from 
+    /// the origin in one pass, see projectPath(). The result is in order and 
+    /// identical for any number of threads. The start point is not written
+    /// \param path Transformed path to use
+    /// \param origin Geographic point of the local point (0, 0) (in degrees)
+    /// \param latitudes Buffer of at least countPoints() latitudes
+    /// \param longitudes Buffer of at least countPoints() longitudes
+    /// \param numberOfThreads Optional. Number of threads to use, one by 
+    /// default
+    /// \param shouldCalculateEarthRadius Optional. True if Earth radius 
+    /// should be calculated for the origin using WSG-84 model, average radius 
+    /// is used otherwise. False by default
+    /// \return Number of written points
+    template<typename Scalar>
+    INLINE std::size_t projectPath(
+        const conn::TransformedPath &path,
+        const conn::BasicGeoPoint<Scalar> origin,
+        Scalar *latitudes,
+        Scalar *longitudes,
+        const std::size_t numberOfThreads = 1,
+        const bool shouldCalculateEarthRadius = false
+    ){
+        Scalar radius = static_cast<Scalar>(conn::earthRadius);
+
+        if(shouldCalculateEarthRadius){
+            radius = static_cast<Scalar>(
+                conn::calculateEarthRadius(origin.latitude)
+            );
+        }
+
+        const Scalar latitude = origin.latitude * static_cast<Scalar>(conn::pi)
+            / static_cast<Scalar>(180.);
+        const Scalar sinLatitude = std::sin(latitude);
+        const Scalar cosLatitude = std::cos(latitude);
+
+        return conn::forEachPointInThreads<Scalar>(
+            path,
+            numberOfThreads,
+            [&](
+                const std::size_t index,
+                const conn::BasicLocalPoint<Scalar> point
+            ){
+                const conn::BasicGeoPoint<Scalar> next =
+                    conn::destinationByAngles(
+                        origin,
+                        sinLatitude,
+                        cosLatitude,
+                        std::sqrt(point.x * point.x + point.y * point.y)
+                            / radius,
+                        conn::kernelAtan2(point.x, point.y)
+                    );
+
+                latitudes[index] = next.latitude;
+                longitudes[index] = next.longitude;
+            }
+        );
+    }
+
+    /// \fn std::size_t projectPath(const TransformedPath &path, const 
+    /// BasicLocalFrame<Scalar> &frame, Scalar *latitudes, Scalar *longitudes, 
+    /// const std::size_t numberOfThreads = 1);
+    /// \brief Calculates geographic points of a transformed path with a local 
+    /// frame
+    /// \details This function calculates points of a path, transforms them 
+    /// and converts them with a local frame in one pass, see projectPath(). 
+    /// The result is in order and identical for any number of threads. The 
+    /// start point is not written
+    /// \param path Transformed path to use
+    /// \param frame Frame of the path
+    /// \param latitudes Buffer of at least countPoints() latitudes
+    /// \param longitudes Buffer of at least countPoints() longitudes
+    /// \param numberOfThreads Optional. Number of threads to use, one by 
+    /// default
+    /// \return Number of written points
+    template<typename Scalar>
+    INLINE std::size_t projectPath(
+        const conn::TransformedPath &path,
+        const conn::BasicLocalFrame<Scalar> &frame,
+        Scalar *latitudes,
+        Scalar *longitudes,
+        const std::size_t numberOfThreads = 1
+    ){
+        return conn::forEachPointInThreads<Scalar>(
+            path,
+            numberOfThreads,
+            [&](
+                const std::size_t index,
+                const conn::BasicLocalPoint<Scalar> point
+            ){
+                const conn::BasicGeoPoint<Scalar> next = frame.geoPoint(point);
+
+                latitudes[index] = next.latitude;
+                longitudes[index] = next.longitude;
+            }
+        );
+    }
+
+    /// \} End of TransformFunctions Group
+
+    /// \defgroup TrackFunctions Track Functions
+    /// \brief Functions creating different tracks to test your vehicle
+    /// \details Group of functions that creates different track to test your 
+    /// vehicle. The angle is calculated from the vertical axis clockwise in 
+    /// radians.
+    /// \{
+
+    /// \fn template<typename Type, typename Allocator> void 
+    /// reserveSpace(std::vector<Type, Allocator> &list, const std::size_t 
+    /// count);
+    /// \brief Reserves space in a list
+    /// \details This function makes sure that \p count more elements can be 
+    /// added to a list without reallocation. The capacity at least doubles 
+    /// if it grows, so adding to a list many times stays cheap
+    /// \param list List to reserve space in
+    /// \param count Number of elements to be added
+    template<typename Type, typename Allocator>
+    INLINE void reserveSpace(
+        std::vector<Type, Allocator> &list,
+        const std::size_t count
+    ){
+        if(list.capacity() < list.size() + count){
+            list.reserve(std::max(list.size() + count, 2 * list.capacity()));
+        }
+    }
+
+    /// \fn std::size_t countLinePoints(const std::size_t numberOfPoints);
+    /// \brief Counts points that form a line
+    /// \details This function counts points that line() adds
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Number of points
+    INLINE constexpr std::size_t countLinePoints(
+        const std::size_t numberOfPoints
+    ){
+        return numberOfPoints;
+    }
+
+    /// \fn std::size_t countRectanglePoints(const std::size_t numberOfPoints);
+    /// \brief Counts points that form a rectangle
+    /// \details This function counts points that rectangle() adds
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Number of points
+    INLINE constexpr std::size_t countRectanglePoints(
+        const std::size_t numberOfPoints
+    ){
+        return 4 * numberOfPoints;
+    }
+
+    /// \fn std::size_t countSquarePoints(const std::size_t numberOfPoints);
+    /// \brief Counts points that form a square
+    /// \details This function counts points that square() adds
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Number of points
+    INLINE constexpr std::size_t countSquarePoints(
+        const std::size_t numberOfPoints
+    ){
+        return conn::countRectanglePoints(numberOfPoints);
+    }
+
+    /// \fn std::size_t countSpiralPoints(const std::size_t numberOfPoints);
+    /// \brief Counts points that form a spiral
+    /// \details This function counts points that spiral() adds
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Number of points
+    INLINE constexpr std::size_t countSpiralPoints(
+        const std::size_t numberOfPoints
+    ){
+        return numberOfPoints;
+    }
+
+    /// \fn std::size_t countSectorPoints(const std::size_t numberOfPoints);
+    /// \brief Counts points that form a sector
+    /// \details This function counts points that sector() adds
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Number of points
+    INLINE constexpr std::size_t countSectorPoints(
+        const std::size_t numberOfPoints
+    ){
+        return conn::countSpiralPoints(numberOfPoints);
+    }
+
+    /// \fn std::size_t countCirclePoints(const std::size_t numberOfPoints);
+    /// \brief Counts points that form a circle
+    /// \details This function counts points that circle() adds
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Number of points
+    INLINE constexpr std::size_t countCirclePoints(
+        const std::size_t numberOfPoints
+    ){
+        return conn::countSpiralPoints(numberOfPoints);
+    }
+
+    /// \fn std::size_t countSquiggleSegments(const std::size_t 
+    /// numberOfLines);
+    /// \brief Counts segments that form a squiggle
+    /// \details This function counts segments (lines and turns) that 
+    /// squiggle() adds
+    /// \param numberOfLines Number of straight lines between turns
+    /// \return Number of segments
+    INLINE constexpr std::size_t countSquiggleSegments(
+        const std::size_t numberOfLines
+    ){
+        return 0 == numberOfLines ? 1 : 2 * numberOfLines - 1;
+    }
+
+    /// \fn std::size_t countSquigglePoints(const std::size_t numberOfLines, 
+    /// const std::size_t numberOfPoints);
+    /// \brief Counts points that form a squiggle
+    /// \details This function counts points that squiggle() adds
+    /// \param numberOfLines Number of straight lines between turns
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Number of points
+    INLINE constexpr std::size_t countSquigglePoints(
+        const std::size_t numberOfLines,
+        const std::size_t numberOfPoints
+    ){
+        return numberOfPoints * conn::countSquiggleSegments(numberOfLines);
+    }
+
+    /// \fn std::size_t countLetterPiPoints(const std::size_t numberOfPoints);
+    /// \brief Counts points that form a letter pi
+    /// \details This function counts points that letterPi() adds
+    /// \param numberOfPoints Number of points per elementary figure
+    /// \return Number of points
+    INLINE constexpr std::size_t countLetterPiPoints(
+        const std::size_t numberOfPoints
+    ){
+        return 7 * numberOfPoints;
+    }
+
+    /// \struct Sampling
+    /// \brief Density of points set by tolerances
+    /// \details Limits that the track functions use instead of a fixed 
+    /// number of points per elementary figure: each figure gets the smallest 
+    /// number of points that keeps both of them. Zero turns a limit off. 
+    /// Lines only have the spacing limit, since their chords are exact
+    struct Sampling{
+        /// \brief Largest distance between a curve and its chords in meters
+        double chordError;
+
+        /// \brief Largest distance between neighbouring points in meters
+        double spacing;
+    };
+
+    /// \fn std::size_t countLineSamples(const double length, const Sampling 
+    /// &sampling);
+    /// \brief Counts points of a line needed for a sampling
+    /// \details This function calculates the smallest number of points of a 
+    /// line that keeps the spacing of \p sampling
+    /// \param length Length of the line in meters
+    /// \param sampling Limits to keep
+    /// \return Number of points, at least one
+    INLINE std::size_t countLineSamples(
+        const double length,
+        const conn::Sampling &sampling
+    ){
+        if(0. >= sampling.spacing){
+            return 1;
+        }
+
+        return std::max<std::size_t>(
+            1,
+            static_cast<std::size_t>(ceil(fabs(length) / sampling.spacing))
+        );
+    }
+
+    /// \fn std::size_t countSpiralSamples(const double initialRadius, const 
+    /// double initialAngle, const double finishRadius, const double 
+    /// finishAngle, const Sampling &sampling);
+    /// \brief Counts points of a spiral needed for a sampling
+    /// \details This function calculates the smallest number of points of a 
+    /// spiral that keeps the limits of \p sampling. Points of a spiral are 
+    /// evenly spaced by angle, so the largest radius decides: an arc of 
+    /// radius r deviates from its chord by at most e if the chord spans 
+    /// 2 acos(1 - e / r), and a step spans at most the hypotenuse of the arc 
+    /// of the largest radius and the change of the radius
+    /// \param initialRadius Initial radius of the spiral in meters
+    /// \param initialAngle Initial angle of the spiral in radians
+    /// \param finishRadius Finish radius of the spiral in meters
+    /// \param finishAngle Finish angle of the spiral in radians
+    /// \param sampling Limits to keep
+    /// \return Number of points, at least one
+    INLINE std::size_t countSpiralSamples(
+        const double initialRadius,
+        const double initialAngle,
+        const double finishRadius,
+        const double finishAngle,
+        const conn::Sampling &sampling
+    ){
+        const double radius = std::max(
+            fabs(initialRadius),
+            fabs(finishRadius)
+        );
+        const double deltaAngle = fabs(finishAngle - initialAngle);
+        const double deltaRadius = fabs(finishRadius - initialRadius);
+
+        double numberOfPoints = 1.;
+
+        if(0. < sampling.chordError && 0. < radius * deltaAngle){
+            const double step = sampling.chordError < radius
+                ? 2. * acos(1. - sampling.chordError / radius)
+                : conn::pi;
+
+            numberOfPoints = std::max(numberOfPoints, ceil(deltaAngle / step));
+        }
+
+        if(0. < sampling.spacing){
+            const double length = sqrt(
+                radius * deltaAngle * radius * deltaAngle
+                + deltaRadius * deltaRadius
+            );
+
+            numberOfPoints = std::max(
+                numberOfPoints,
+                ceil(length / sampling.spacing)
+            );
+        }
+
+        return static_cast<std::size_t>(numberOfPoints);
+    }
+
+    /// \fn std::vector<LocalPoint> localPointsFromPole(const 
+    /// std::vector< std::vector<double> > &points);
+    /// \brief Starts a list of LocalPoint from a pole
+    /// \details This function creates a list of LocalPoint that contains only 
+    /// the last point of \p points, so it can be used as a pole by the track 
+    /// functions
+    /// \param points List of points (should already has an initial point - a 
+    /// pole)
+    /// \return List with the pole
+    INLINE std::vector<conn::LocalPoint> localPointsFromPole(
+        const std::vector< std::vector<double> > &points
+    ){
+        return std::vector<conn::LocalPoint>(
+            1,
+            conn::localPointFromVector(points[points.size() - 1])
+        );
+    }
+
+    /// \fn void appendLocalPoints(std::vector< std::vector<double> > &points, 
+    /// const std::vector<LocalPoint> &localPoints);
+    /// \brief Appends a list of LocalPoint to a list of points
+    /// \details This function appends all points of \p localPoints except the 
+    /// first one (the pole) to \p points
+    /// \param points List to add points
+    /// \param localPoints List of points started by localPointsFromPole()
+    INLINE void appendLocalPoints(
+        std::vector< std::vector<double> > &points,
+        const std::vector<conn::LocalPoint> &localPoints
+    ){
+        conn::reserveSpace(points, localPoints.size() - 1);
+
+        for(std::size_t i = 1; i < localPoints.size(); ++i){
+            points.push_back(conn::vectorFromLocalPoint(localPoints[i]));
+        }
+    }
+
+    /// \fn template<typename Allocator> void 
+    /// appendPoints(std::vector<LocalPoint, Allocator> &points, const Path 
+    /// &path);
+    /// \brief Appends points of a path to a list
+    /// \details This function calculates points of a path and appends them 
+    /// to a list. The start point of the path is not appended
+    /// \param points List to add points
+    /// \param path Path to use
+    template<typename Allocator>
+    INLINE void appendPoints(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const conn::Path &path
+    ){
+        conn::reserveSpace(points, conn::countPoints(path));
+        conn::forEachPoint(path, [&](const conn::LocalPoint point){
+            points.push_back(point);
+        });
+    }
+
+    /// \fn void line(Path &path, const double length, const double angle, 
+    /// const std::size_t numberOfPoints);
+    /// \brief Adds segments that form a line
+    /// \details This function adds segments that form a line to a path, their 
+    /// points are calculated on demand
+    /// \param path Path to add segments to
+    /// \param length Length of the line in meters
+    /// \param angle Tilt angle of the line in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void line(
+        conn::Path &path,
+        const double length,
+        const double angle,
+        const std::size_t numberOfPoints
+    ){
+        CONN_PROBE(conn::Probe::line);
+
+        path.segments.push_back(
+            conn::lineSegment(path.finish(), length, angle, numberOfPoints)
+        );
+    }
+
+    /// \fn template<typename Allocator> void line(std::vector<LocalPoint, 
+    /// Allocator> &points, const double length, const double angle, const 
+    /// std::size_t numberOfPoints);
+    /// \brief Calculates points that form a line
+    /// \details This function calculates points that form a line
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param length Length of the line in meters
+    /// \param angle Tilt angle of the line in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    template<typename Allocator>
+    INLINE void line(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double length,
+        const double angle,
+        const std::size_t numberOfPoints
+    ){
+        CONN_PROBE_OUTPUT(conn::Probe::line, points);
+
+        conn::Path path(
+            points[points.size() - 1],
+            conn::arenaOf(points.get_allocator())
+        );
+
+        conn::line(path, length, angle, numberOfPoints);
+        conn::appendPoints(points, path);
+    }
+
+    /// \fn void line(std::vector< std::vector<double> > &points, const double 
+    /// length, const double angle, const std::size_t numberOfPoints);
+    /// \brief Calculates points that form a line
+    /// \details This function calculates points that form a line
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param length Length of the line in meters
+    /// \param angle Tilt angle of the line in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void line(
+        std::vector< std::vector<double> > &points,
+        const double length,
+        const double angle,
+        const std::size_t numberOfPoints
+    ){
+        CONN_PROBE_OUTPUT(conn::Probe::line, points);
+
+        std::vector<conn::LocalPoint> localPoints = conn::localPointsFromPole(
+            points
+        );
+
+        conn::line(localPoints, length, angle, numberOfPoints);
+        conn::appendLocalPoints(points, localPoints);
+    }
+
+    /// \fn void line(Path &path, const double length, const double angle, 
+    /// const Sampling &sampling);
+    /// \brief Adds segments that form a line
+    /// \details This function adds segments that form a line to a path with 
+    /// as few points as \p sampling allows, see countLineSamples()
+    /// \param path Path to add segments to
+    /// \param length Length of the line in meters
+    /// \param angle Tilt angle of the line in radians
+    /// \param sampling Limits on the points
+    INLINE void line(
+        conn::Path &path,
+        const double length,
+        const double angle,
+        const conn::Sampling &sampling
+    ){
+        conn::line(
+            path,
+            length,
+            angle,
+            conn::countLineSamples(length, sampling)
+        );
+    }
+
+    /// \fn template<typename Allocator> void line(std::vector<LocalPoint, 
+    /// Allocator> &points, const double length, const double angle, const 
+    /// Sampling &sampling);
+    /// \brief Calculates points that form a line
+    /// \details This function calculates points that form a line with as few 
+    /// points as \p sampling allows, see countLineSamples()
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param length Length of the line in meters
+    /// \param angle Tilt angle of the line in radians
+    /// \param sampling Limits on the points
+    template<typename Allocator>
+    INLINE void line(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double length,
+        const double angle,
+        const conn::Sampling &sampling
+    ){
+        conn::line(
+            points,
+            length,
+            angle,
+            conn::countLineSamples(length, sampling)
+        );
+    }
+
+    /// \fn template<typename Density> void rectangle(Path &path, const double 
+    /// width, const double height, double angle, const Density &density);
+    /// \brief Adds segments that form a rectangle
+    /// \details This function adds segments that form a rectangle to a path, 
+    /// their points are calculated on demand
+    /// \param path Path to add segments to
+    /// \param width Width of the line in meters
+    /// \param height Height of the line in meters
+    /// \param angle Tilt angle of the rectangle in radians
+    /// \param density Number of points per elementary figure or their Sampling
+    template<typename Density>
+    INLINE void rectangle(
+        conn::Path &path,
+        const double width,
+        const double height,
+        double angle,
+        const Density &density
+    ){
+        double length = width;
+
+        conn::reserveSpace(path.segments, 4);
+
+        for(size_t i = 0; i < 4; ++i){
+            conn::line(path, length, angle, density);
+            angle += 0.5 * conn::pi;
+
+            if(0 == i % 2){
+                length = height;
+            }else{
+                length = width;
+            }
+        }
+    }
+
+    /// \fn template<typename Allocator, typename Density> void 
+    /// rectangle(std::vector<LocalPoint, Allocator> &points, const double 
+    /// width, const double height, double angle, const Density &density);
+    /// \brief Calculates points that form a rectangle
+    /// \details This function calculates points that form a rectangle
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param width Width of the line in meters
+    /// \param height Height of the line in meters
+    /// \param angle Tilt angle of the rectangle in radians
+    /// \param density Number of points per elementary figure or their Sampling
+    template<typename Allocator, typename Density>
+    INLINE void rectangle(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double width,
+        const double height,
+        double angle,
+        const Density &density
+    ){
+        conn::Path path(
+            points[points.size() - 1],
+            conn::arenaOf(points.get_allocator())
+        );
+
+        conn::rectangle(path, width, height, angle, density);
+        conn::appendPoints(points, path);
+    }
+
+    /// \fn void rectangle(std::vector< std::vector<double> > &points, const 
+    /// double width, const double height, double angle, const std::size_t 
+    /// numberOfPoints);
+    /// \brief Calculates points that form a rectangle
+    /// \details This function calculates points that form a rectangle
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param width Width of the line in meters
+    /// \param height Height of the line in meters
+    /// \param angle Tilt angle of the rectangle in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void rectangle(
+        std::vector< std::vector<double> > &points,
+        const double width,
+        const double height,
+        double angle,
+        const std::size_t numberOfPoints
+    ){
+        std::vector<conn::LocalPoint> localPoints = conn::localPointsFromPole(
+            points
+        );
+
+        conn::rectangle(localPoints, width, height, angle, numberOfPoints);
+        conn::appendLocalPoints(points, localPoints);
+    }
+
+    /// \fn template<typename Density> void square(Path &path, const double 
+    /// square, double angle, const Density &density);
+    /// \brief Adds segments that form a square
+    /// \details This function adds segments that form a square to a path, 
+    /// their points are calculated on demand
+    /// \param path Path to add segments to
+    /// \param length Side length of the square in meters
+    /// \param angle Tilt angle of the square in radians
+    /// \param density Number of points per elementary figure or their Sampling
+    template<typename Density>
+    INLINE void square(
+        conn::Path &path,
+        const double length,
+        const double angle,
+        const Density &density
+    ){
+        conn::rectangle(path, length, length, angle, density);
+    }
+
+    /// \fn template<typename Allocator, typename Density> void 
+    /// square(std::vector<LocalPoint, Allocator> &points, const double square, 
+    /// double angle, const Density &density);
+    /// \brief Calculates points that form a square
+    /// \details This function calculates points that form a square
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param length Side length of the square in meters
+    /// \param angle Tilt angle of the square in radians
+    /// \param density Number of points per elementary figure or their Sampling
+    template<typename Allocator, typename Density>
+    INLINE void square(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double length,
+        const double angle,
+        const Density &density
+    ){
+        conn::Path path(
+            points[points.size() - 1],
+            conn::arenaOf(points.get_allocator())
+        );
+
+        conn::square(path, length, angle, density);
+        conn::appendPoints(points, path);
+    }
+
+    /// \fn void square(std::vector< std::vector<double> > &points, const 
+    /// double square, double angle, const std::size_t numberOfPoints);
+    /// \brief Calculates points that form a square
+    /// \details This function calculates points that form a square
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param length Side length of the square in meters
+    /// \param angle Tilt angle of the square in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void square(
+        std::vector< std::vector<double> > &points,
+        const double length,
+        const double angle,
+        const std::size_t numberOfPoints
+    ){
+        conn::rectangle(points, length, length, angle, numberOfPoints);
+    }
+
+    /// \fn void spiral(Path &path, const double initialRadius, const double 
+    /// initialAngle, const double finishRadius, const double finishAngle, 
+    /// const std::size_t numberOfPoints);
+    /// \brief Adds segments that form a spiral
+    /// \details This function adds segments that form a spiral to a path, 
+    /// their points are calculated on demand
+    /// \param path Path to add segments to
+    /// \param initialRadius Initial radius of the spiral in meters
+    /// \param initialAngle Initial angle of the spiral in radians
+    /// \param finishRadius Finish radius of the spiral in meters
+    /// \param finishAngle Finish angle of the spiral in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void spiral(
+        conn::Path &path,
+        const double initialRadius,
+        const double initialAngle,
+        const double finishRadius,
+        const double finishAngle,
+        const std::size_t numberOfPoints
+    ){
+        CONN_PROBE(conn::Probe::spiral);
+
+        path.segments.push_back(
+            conn::spiralSegment(
+                path.finish(),
+                initialRadius,
+                initialAngle,
+                finishRadius,
+                finishAngle,
+                numberOfPoints
+            )
+        );
+    }
+
+    /// \fn template<typename Allocator> void spiral(std::vector<LocalPoint, 
+    /// Allocator> &points, const double initialRadius, const double 
+    /// initialAngle, const double finishRadius, const double finishAngle, 
+    /// const std::size_t numberOfPoints);
+    /// \brief Calculates points that form a spiral
+    /// \details This function calculates points that form a spiral
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param initialRadius Initial radius of the spiral in meters
+    /// \param initialAngle Initial angle of the spiral in radians
+    /// \param finishRadius Finish radius of the spiral in meters
+    /// \param finishAngle Finish angle of the spiral in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    template<typename Allocator>
+    INLINE void spiral(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double initialRadius,
+        const double initialAngle,
+        const double finishRadius,
+        const double finishAngle,
+        const std::size_t numberOfPoints
+    ){
+        CONN_PROBE_OUTPUT(conn::Probe::spiral, points);
+
+        conn::Path path(
+            points[points.size() - 1],
+            conn::arenaOf(points.get_allocator())
+        );
+
+        conn::spiral(
+            path,
+            initialRadius,
+            initialAngle,
+            finishRadius,
+            finishAngle,
+            numberOfPoints
+        );
+        conn::appendPoints(points, path);
+    }
+
+    /// \fn void spiral(std::vector< std::vector<double> > &points, const 
+    /// double initialRadius, const double initialAngle, const double 
+    /// finishRadius, const double finishAngle, const std::size_t 
+    /// numberOfPoints);
+    /// \brief Calculates points that form a spiral
+    /// \details This function calculates points that form a spiral
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param initialRadius Initial radius of the spiral in meters
+    /// \param initialAngle Initial angle of the spiral in radians
+    /// \param finishRadius Finish radius of the spiral in meters
+    /// \param finishAngle Finish angle of the spiral in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void spiral(
+        std::vector< std::vector<double> > &points,
+        const double initialRadius,
+        const double initialAngle,
+        const double finishRadius,
+        const double finishAngle,
+        const std::size_t numberOfPoints
+    ){
+        CONN_PROBE_OUTPUT(conn::Probe::spiral, points);
+
+        std::vector<conn::LocalPoint> localPoints = conn::localPointsFromPole(
+            points
+        );
+
+        conn::spiral(
+            localPoints,
+            initialRadius,
+            initialAngle,
+            finishRadius,
+            finishAngle,
+            numberOfPoints
+        );
+        conn::appendLocalPoints(points, localPoints);
+    }
+
+    /// \fn void spiral(Path &path, const double initialRadius, const double 
+    /// initialAngle, const double finishRadius, const double finishAngle, 
+    /// const Sampling &sampling);
+    /// \brief Adds segments that form a spiral
+    /// \details This function adds segments that form a spiral to a path 
+    /// with as few points as \p sampling allows, see countSpiralSamples()
+    /// \param path Path to add segments to
+    /// \param initialRadius Initial radius of the spiral in meters
+    /// \param initialAngle Initial angle of the spiral in radians
+    /// \param finishRadius Finish radius of the spiral in meters
+    /// \param finishAngle Finish angle of the spiral in radians
+    /// \param sampling Limits on the points
+    INLINE void spiral(
+        conn::Path &path,
+        const double initialRadius,
+        const double initialAngle,
+        const double finishRadius,
+        const double finishAngle,
+        const conn::Sampling &sampling
+    ){
+        conn::spiral(
+            path,
+            initialRadius,
+            initialAngle,
+            finishRadius,
+            finishAngle,
+            conn::countSpiralSamples(
+                initialRadius,
+                initialAngle,
+                finishRadius,
+                finishAngle,
+                sampling
+            )
+        );
+    }
+
+    /// \fn template<typename Allocator> void spiral(std::vector<LocalPoint, 
+    /// Allocator> &points, const double initialRadius, const double 
+    /// initialAngle, const double finishRadius, const double finishAngle, 
+    /// const Sampling &sampling);
+    /// \brief Calculates points that form a spiral
+    /// \details This function calculates points that form a spiral with as 
+    /// few points as \p sampling allows, see countSpiralSamples()
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param initialRadius Initial radius of the spiral in meters
+    /// \param initialAngle Initial angle of the spiral in radians
+    /// \param finishRadius Finish radius of the spiral in meters
+    /// \param finishAngle Finish angle of the spiral in radians
+    /// \param sampling Limits on the points
+    template<typename Allocator>
+    INLINE void spiral(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double initialRadius,
+        const double initialAngle,
+        const double finishRadius,
+        const double finishAngle,
+        const conn::Sampling &sampling
+    ){
+        conn::spiral(
+            points,
+            initialRadius,
+            initialAngle,
+            finishRadius,
+            finishAngle,
+            conn::countSpiralSamples(
+                initialRadius,
+                initialAngle,
+                finishRadius,
+                finishAngle,
+                sampling
+            )
+        );
+    }
+
+    /// \fn void sector(Path &path, const double radius, const double 
+    /// initialAngle, const double finishAngle, const std::size_t 
+    /// numberOfPoints);
+    /// \brief Adds segments that form a sector
+    /// \details This function adds segments that form a sector to a path, 
+    /// their points are calculated on demand
+    /// \param path Path to add segments to
+    /// \param radius Radius of the sector in meters
+    /// \param initialAngle Initial angle of the sector in radians
+    /// \param finishAngle Finish angle of the sector in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void sector(
+        conn::Path &path,
+        const double radius,
+        const double initialAngle,
+        const double finishAngle,
+        const std::size_t numberOfPoints
+    ){
+        conn::spiral(
+            path, radius, initialAngle, radius, finishAngle, numberOfPoints
+        );
+    }
+
+    /// \fn template<typename Allocator> void sector(std::vector<LocalPoint, 
+    /// Allocator> &points, const double radius, const double initialAngle, 
+    /// const double finishAngle, const std::size_t numberOfPoints);
+    /// \brief Calculates points that form a sector
+    /// \details This function calculates points that form a sector
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param radius Radius of the sector in meters
+    /// \param initialAngle Initial angle of the sector in radians
+    /// \param finishAngle Finish angle of the sector in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    template<typename Allocator>
+    INLINE void sector(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double radius,
+        const double initialAngle,
+        const double finishAngle,
+        const std::size_t numberOfPoints
+    ){
+        conn::Path path(
+            points[points.size() - 1],
+            conn::arenaOf(points.get_allocator())
+        );
+
+        conn::sector(path, radius, initialAngle, finishAngle, numberOfPoints);
+        conn::appendPoints(points, path);
+    }
+
+    /// \fn void sector(std::vector< std::vector<double> > &points, const 
+    /// double radius, const double initialAngle, const double finishAngle, 
+    /// const std::size_t numberOfPoints);
+    /// \brief Calculates points that form a sector
+    /// \details This function calculates points that form a sector
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param radius Radius of the sector in meters
+    /// \param initialAngle Initial angle of the sector in radians
+    /// \param finishAngle Finish angle of the sector in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void sector(
+        std::vector< std::vector<double> > &points,
+        const double radius,
+        const double initialAngle,
+        const double finishAngle,
+        const std::size_t numberOfPoints
+    ){
+        conn::spiral(
+            points, radius, initialAngle, radius, finishAngle, numberOfPoints
+        );
+    }
+
+    /// \fn void sector(Path &path, const double radius, const double 
+    /// initialAngle, const double finishAngle, const Sampling &sampling);
+    /// \brief Adds segments that form a sector
+    /// \details This function adds segments that form a sector to a path 
+    /// with as few points as \p sampling allows, see countSpiralSamples()
+    /// \param path Path to add segments to
+    /// \param radius Radius of the sector in meters
+    /// \param initialAngle Initial angle of the sector in radians
+    /// \param finishAngle Finish angle of the sector in radians
+    /// \param sampling Limits on the points
+    INLINE void sector(
+        conn::Path &path,
+        const double radius,
+        const double initialAngle,
+        const double finishAngle,
+        const conn::Sampling &sampling
+    ){
+        conn::spiral(path, radius, initialAngle, radius, finishAngle, sampling);
+    }
+
+    /// \fn template<typename Allocator> void sector(std::vector<LocalPoint, 
+    /// Allocator> &points, const double radius, const double initialAngle, 
+    /// const double finishAngle, const Sampling &sampling);
+    /// \brief Calculates points that form a sector
+    /// \details This function calculates points that form a sector with as 
+    /// few points as \p sampling allows, see countSpiralSamples()
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param radius Radius of the sector in meters
+    /// \param initialAngle Initial angle of the sector in radians
+    /// \param finishAngle Finish angle of the sector in radians
+    /// \param sampling Limits on the points
+    template<typename Allocator>
+    INLINE void sector(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double radius,
+        const double initialAngle,
+        const double finishAngle,
+        const conn::Sampling &sampling
+    ){
+        conn::spiral(
+            points,
+            radius,
+            initialAngle,
+            radius,
+            finishAngle,
+            sampling
+        );
+    }
+
+    /// \fn void circle(Path &path, const double radius, const double angle, 
+    /// const std::size_t numberOfPoints);
+    /// \brief Adds segments that form a circle
+    /// \details This function adds segments that form a circle to a path, 
+    /// their points are calculated on demand
+    /// \param path Path to add segments to
+    /// \param radius Radius of the circle in meters
+    /// \param angle Initial angle of the circle in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void circle(
+        conn::Path &path,
+        const double radius,
+        const double angle,
+        const std::size_t numberOfPoints
+    ){
+        conn::spiral(
+            path, radius, angle, radius, angle + 2 * conn::pi, numberOfPoints
+        );
+    }
+
+    /// \fn template<typename Allocator> void circle(std::vector<LocalPoint, 
+    /// Allocator> &points, const double radius, const double angle, const 
+    /// std::size_t numberOfPoints);
+    /// \brief Calculates points that form a circle
+    /// \details This function calculates points that form a circle
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param radius Radius of the circle in meters
+    /// \param angle Initial angle of the circle in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    template<typename Allocator>
+    INLINE void circle(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double radius,
+        const double angle,
+        const std::size_t numberOfPoints
+    ){
+        conn::Path path(
+            points[points.size() - 1],
+            conn::arenaOf(points.get_allocator())
+        );
+
+        conn::circle(path, radius, angle, numberOfPoints);
+        conn::appendPoints(points, path);
+    }
+
+    /// \fn void circle(std::vector< std::vector<double> > &points, const 
+    /// double radius, const double angle, const std::size_t numberOfPoints);
+    /// \brief Calculates points that form a circle
+    /// \details This function calculates points that form a circle
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param radius Radius of the circle in meters
+    /// \param angle Initial angle of the circle in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void circle(
+        std::vector< std::vector<double> > &points,
+        const double radius,
+        const double angle,
+        const std::size_t numberOfPoints
+    ){
+        conn::spiral(
+            points, radius, angle, radius, angle + 2 * conn::pi, numberOfPoints
+        );
+    }
+
+    /// \fn void circle(Path &path, const double radius, const double angle, 
+    /// const Sampling &sampling);
+    /// \brief Adds segments that form a circle
+    /// \details This function adds segments that form a circle to a path 
+    /// with as few points as \p sampling allows, see countSpiralSamples()
+    /// \param path Path to add segments to
+    /// \param radius Radius of the circle in meters
+    /// \param angle Initial angle of the circle in radians
+    /// \param sampling Limits on the points
+    INLINE void circle(
+        conn::Path &path,
+        const double radius,
+        const double angle,
+        const conn::Sampling &sampling
+    ){
+        conn::spiral(
+            path, radius, angle, radius, angle + 2 * conn::pi, sampling
+        );
+    }
+
+    /// \fn template<typename Allocator> void circle(std::vector<LocalPoint, 
+    /// Allocator> &points, const double radius, const double angle, const 
+    /// Sampling &sampling);
+    /// \brief Calculates points that form a circle
+    /// \details This function calculates points that form a circle with as 
+    /// few points as \p sampling allows, see countSpiralSamples()
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param radius Radius of the circle in meters
+    /// \param angle Initial angle of the circle in radians
+    /// \param sampling Limits on the points
+    template<typename Allocator>
+    INLINE void circle(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double radius,
+        const double angle,
+        const conn::Sampling &sampling
+    ){
+        conn::spiral(
+            points, radius, angle, radius, angle + 2 * conn::pi, sampling
+        );
+    }
+
+    /// \fn template<typename Density> void squiggle(Path &path, const double 
+    /// length, const double radius, double angle, double rotationAngle, const 
+    /// std::size_t numberOfLines, const Density &density);
+    /// \brief Adds segments that form a squiggle
+    /// \details This function adds segments that form a squiggle to a path, 
+    /// their points are calculated on demand
+    /// \param path Path to add segments to
+    /// \param length Length of the straight lines between turns in meters
+    /// \param radius Radius of the turn in meters
+    /// \param angle Initial angle of the squiggle in radians
+    /// \param rotationAngle Angle of rotation. Assumed it is pi / 2, not cool 
+    /// otherwise.
+    /// \param numberOfLines Number of straight lines between turns
+    /// \param density Number of points per elementary figure or their Sampling
+    template<typename Density>
+    INLINE void squiggle(
+        conn::Path &path,
+        const double length,
+        const double radius,
+        double angle,
+        double rotationAngle,
+        const std::size_t numberOfLines,
+        const Density &density
+    ){
+        conn::reserveSpace(
+            path.segments,
+            conn::countSquiggleSegments(numberOfLines)
+        );
+        conn::line(path, length, angle, density);
+
+        double nextAngle = angle + rotationAngle;
+        double initialRotationAngle = -0.5 * conn::pi;
+
+        for(std::size_t i = 1; i < numberOfLines; ++i){
+            conn::sector(
+                path,
+                radius,
+                angle + initialRotationAngle,
+                nextAngle + initialRotationAngle,
+                density
+            );
+
+            angle = nextAngle;
+            initialRotationAngle *= -1;
+
+            conn::line(path, length, angle, density);
+
+            if(0 == i % 2){
+                nextAngle += rotationAngle;
+            }else{
+                nextAngle -= rotationAngle;
+            }
+        }
+    }
+
+    /// \fn template<typename Allocator, typename Density> void 
+    /// squiggle(std::vector<LocalPoint, Allocator> &points, const double 
+    /// length, const double radius, double angle, double rotationAngle, const 
+    /// std::size_t numberOfLines, const Density &density);
+    /// \brief Calculates points that form a squiggle
+    /// \details This function calculates points that form a squiggle
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param length Length of the straight lines between turns in meters
+    /// \param radius Radius of the turn in meters
+    /// \param angle Initial angle of the squiggle in radians
+    /// \param rotationAngle Angle of rotation. Assumed it is pi / 2, not cool 
+    /// otherwise.
+    /// \param numberOfLines Number of straight lines between turns
+    /// \param density Number of points per elementary figure or their Sampling
+    template<typename Allocator, typename Density>
+    INLINE void squiggle(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double length,
+        const double radius,
+        double angle,
+        double rotationAngle,
+        const std::size_t numberOfLines,
+        const Density &density
+    ){
+        conn::Path path(
+            points[points.size() - 1],
+            conn::arenaOf(points.get_allocator())
+        );
+
+        conn::squiggle(
+            path,
+            length,
+            radius,
+            angle,
+            rotationAngle,
+            numberOfLines,
+            density
+        );
+        conn::appendPoints(points, path);
+    }
+
+    /// \fn void squiggle(std::vector< std::vector<double> > &points, const 
+    /// double length, const double radius, double angle, double 
+    /// rotationAngle, const std::size_t numberOfLines, const std::size_t 
+    /// numberOfPoints);
+    /// \brief Calculates points that form a squiggle
+    /// \details This function calculates points that form a squiggle
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param length Length of the straight lines between turns in meters
+    /// \param radius Radius of the turn in meters
+    /// \param angle Initial angle of the squiggle in radians
+    /// \param rotationAngle Angle of rotation. Assumed it is pi / 2, not cool 
+    /// otherwise.
+    /// \param numberOfLines Number of straight lines between turns
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void squiggle(
+        std::vector< std::vector<double> > &points,
+        const double length,
+        const double radius,
+        double angle,
+        double rotationAngle,
+        const std::size_t numberOfLines,
+        const std::size_t numberOfPoints
+    ){
+        std::vector<conn::LocalPoint> localPoints = conn::localPointsFromPole(
+            points
+        );
+
+        conn::squiggle(
+            localPoints,
+            length,
+            radius,
+            angle,
+            rotationAngle,
+            numberOfLines,
+            numberOfPoints
+        );
+        conn::appendLocalPoints(points, localPoints);
+    }
+
+    /// \class Squiggle
+    /// \brief Squiggle with random access to its points
+    /// \details Describes the same track as squiggle() (a lawn-mower 
+    /// pattern), but finds any segment or point in constant time instead of 
+    /// building all the previous ones. Headings of the lines alternate 
+    /// between two values and so do the turns, hence the start of line i is 
+    /// the start point plus ceil(i / 2) and floor(i / 2) times two fixed 
+    /// offsets. Segment 2i is line i and segment 2i - 1 is the turn before 
+    /// it. Positions agree with squiggle() up to rounding, since the latter 
+    /// accumulates them segment by segment
+    class Squiggle{
+        public:
+            /// \brief Describes a squiggle
+            /// \param start Start point (a pole)
+            /// \param length Length of the straight lines between turns in 
+            /// meters
+            /// \param radius Radius of the turn in meters
+            /// \param angle Initial angle of the squiggle in radians
+            /// \param rotationAngle Angle of rotation, see squiggle()
+            /// \param numberOfLines Number of straight lines between turns
+            /// \param numberOfPoints Number of points per elementary figure
+            Squiggle(
+                const conn::LocalPoint start,
+                const double length,
+                const double radius,
+                const double angle,
+                const double rotationAngle,
+                const std::size_t numberOfLines,
+                const std::size_t numberOfPoints
+            ) : start(start),
+                length(length),
+                radius(radius),
+                angle(angle),
+                rotationAngle(rotationAngle),
+                numberOfLines(std::max<std::size_t>(numberOfLines, 1)),
+                numberOfLinePoints(numberOfPoints),
+                numberOfTurnPoints(numberOfPoints){
+                this->calculateOffsets();
+            }
+
+            /// \brief Describes a squiggle with sampling by tolerances
+            /// \param start Start point (a pole)
+            /// \param length Length of the straight lines between turns in 
+            /// meters
+            /// \param radius Radius of the turn in meters
+            /// \param angle Initial angle of the squiggle in radians
+            /// \param rotationAngle Angle of rotation, see squiggle()
+            /// \param numberOfLines Number of straight lines between turns
+            /// \param sampling Limits on the points, see Sampling
+            Squiggle(
+                const conn::LocalPoint start,
+                const double length,
+                const double radius,
+                const double angle,
+                const double rotationAngle,
+                const std::size_t numberOfLines,
+                const conn::Sampling &sampling
+            ) : start(start),
+                length(length),
+                radius(radius),
+                angle(angle),
+                rotationAngle(rotationAngle),
+                numberOfLines(std::max<std::size_t>(numberOfLines, 1)),
+                numberOfLinePoints(conn::countLineSamples(length, sampling)),
+                numberOfTurnPoints(
+                    conn::countSpiralSamples(
+                        radius,
+                        0.,
+                        radius,
+                        rotationAngle,
+                        sampling
+                    )
+                ){
+                this->calculateOffsets();
+            }
+
+            /// \brief Gets the number of segments
+            /// \return Number of segments, see countSquiggleSegments()
+            std::size_t getNumberOfSegments() const{
+                return 2 * this->numberOfLines - 1;
+            }
+
+            /// \brief Gets the number of points
+            /// \return Number of points, the start point is not counted
+            std::size_t getNumberOfPoints() const{
+                return this->numberOfLines * this->numberOfLinePoints
+                    + (this->numberOfLines - 1) * this->numberOfTurnPoints;
+            }
+
+            /// \brief Gets the number of lines
+            /// \return Number of straight lines
+            std::size_t getNumberOfLines() const{
+                return this->numberOfLines;
+            }
+
+            /// \brief Calculates the heading of a line
+            /// \param line Index of the line
+            /// \return Tilt angle of the line in radians
+            double lineAngle(const std::size_t line) const{
+                return 0 == line % 2
+                    ? this->angle
+                    : this->angle + this->rotationAngle;
+            }
+
+            /// \brief Calculates the start point of a line
+            /// \param line Index of the line
+            /// \return Start point (a pole) of the line
+            conn::LocalPoint lineStart(const std::size_t line) const{
+                const double odd = static_cast<double>((line + 1) / 2);
+                const double even = static_cast<double>(line / 2);
+
+                return conn::LocalPoint{
+                    this->start.x + odd * this->oddOffset.x
+                        + even * this->evenOffset.x,
+                    this->start.y + odd * this->oddOffset.y
+                        + even * this->evenOffset.y
+                };
+            }
+
+            /// \brief Describes a segment
+            /// \param index Index of the segment, line i has index 2i and 
+            /// the turn before it has index 2i - 1
+            /// \return Segment
+            conn::Segment segment(const std::size_t index) const{
+                const std::size_t line = (index + 1) / 2;
+
+                if(0 == index % 2){
+                    return conn::lineSegment(
+                        this->lineStart(line),
+                        this->length,
+                        this->lineAngle(line),
+                        this->numberOfLinePoints
+                    );
+                }
+
+                const double previousAngle = this->lineAngle(line - 1);
+                const double rotation = 0 == line % 2
+                    ? 0.5 * conn::pi
+                    : -0.5 * conn::pi;
+                const conn::LocalPoint previousStart = this->lineStart(
+                    line - 1
+                );
+
+                return conn::spiralSegment(
+                    conn::LocalPoint{
+                        previousStart.x + this->length * sin(previousAngle),
+                        previousStart.y + this->length * cos(previousAngle)
+                    },
+                    this->radius,
+                    previousAngle + rotation,
+                    this->radius,
+                    this->lineAngle(line) + rotation,
+                    this->numberOfTurnPoints
+                );
+            }
+
+            /// \brief Finds the segment of a point
+            /// \param index Index of the point
+            /// \return Index of the segment
+            std::size_t segmentOfPoint(const std::size_t index) const{
+                if(index < this->numberOfLinePoints){
+                    return 0;
+                }
+
+                const std::size_t rest = index - this->numberOfLinePoints;
+                const std::size_t period = this->numberOfLinePoints
+                    + this->numberOfTurnPoints;
+                const std::size_t line = rest / period + 1;
+
+                return rest % period < this->numberOfTurnPoints
+                    ? 2 * line - 1
+                    : 2 * line;
+            }
+
+            /// \brief Finds the first point of a segment
+            /// \param index Index of the segment
+            /// \return Index of its first point
+            std::size_t firstPointOfSegment(const std::size_t index) const{
+                return (index + 1) / 2 * this->numberOfLinePoints
+                    + index / 2 * this->numberOfTurnPoints;
+            }
+
+            /// \brief Calculates a point
+            /// \param index Index of the point, from 0 to 
+            /// getNumberOfPoints() - 1
+            /// \return Point
+            conn::LocalPoint point(const std::size_t index) const{
+                const std::size_t segment = this->segmentOfPoint(index);
+
+                return conn::segmentPoint(
+                    this->segment(segment),
+                    index - this->firstPointOfSegment(segment)
+                );
+            }
+
+            /// \brief Adds segments to a path
+            /// \details Adds a range of segments, e.g. the rest of the track 
+            /// after a resume, without calculating the previous ones
+            /// \param path Path to add segments to, its finish should be the 
+            /// start point of the first segment
+            /// \param first Index of the first segment to add
+            /// \param count Number of segments to add
+            void appendSegments(
+                conn::Path &path,
+                const std::size_t first,
+                std::size_t count
+            ) const{
+                count = std::min(
+                    count,
+                    this->getNumberOfSegments() - std::min(
+                        first,
+                        this->getNumberOfSegments()
+                    )
+                );
+                conn::reserveSpace(path.segments, count);
+
+                for(std::size_t i = first; i < first + count; ++i){
+                    path.segments.push_back(this->segment(i));
+                }
+            }
+
+            /// \brief Creates a path of the whole squiggle
+            /// \return Path starting at the start point
+            conn::Path path() const{
+                conn::Path path(this->start);
+
+                this->appendSegments(path, 0, this->getNumberOfSegments());
+
+                return path;
+            }
+
+        private:
+            void calculateOffsets(){
+                const double secondAngle = this->angle + this->rotationAngle;
+                const double halfTurn = 0.5 * conn::pi;
+
+                // Line 2k + 1 starts after an even line and an odd turn,
+                // line 2k + 2 after an odd line and an even turn
+                this->oddOffset = conn::LocalPoint{
+                    this->length * sin(this->angle)
+                        + this->radius * (
+                            sin(secondAngle - halfTurn)
+                            - sin(this->angle - halfTurn)
+                        ),
+                    this->length * cos(this->angle)
+                        + this->radius * (
+                            cos(secondAngle - halfTurn)
+                            - cos(this->angle - halfTurn)
+                        )
+                };
+                this->evenOffset = conn::LocalPoint{
+                    this->length * sin(secondAngle)
+                        + this->radius * (
+                            sin(this->angle + halfTurn)
+                            - sin(secondAngle + halfTurn)
+                        ),
+                    this->length * cos(secondAngle)
+                        + this->radius * (
+                            cos(this->angle + halfTurn)
+                            - cos(secondAngle + halfTurn)
+                        )
+                };
+            }
+
+            conn::LocalPoint start;
+            double length;
+            double radius;
+            double angle;
+            double rotationAngle;
+            std::size_t numberOfLines;
+            std::size_t numberOfLinePoints;
+            std::size_t numberOfTurnPoints;
+            conn::LocalPoint oddOffset;
+            conn::LocalPoint evenOffset;
+    };
+
+    /// \fn template<typename Density> void letterPi(Path &path, const double 
+    /// verticalLength, const double horizontalLength, const double radius, 
+    /// double angle, const Density &density);
+    /// \brief Adds segments that form a letter pi
+    /// \details This function adds segments that form something that looks 
+    /// close to a pi letter to a path, their points are calculated on demand
+    /// \param path Path to add segments to
+    /// \param verticalLength Length of the vertical line segment in meters
+    /// \param horizontalLength Length of the horizontal line segment in meters
+    /// \param radius Radius of the round segment in meters
+    /// \param angle Initial angle of the letter in radians
+    /// \param density Number of points per elementary figure or their Sampling
+    template<typename Density>
+    INLINE void letterPi(
+        conn::Path &path,
+        const double verticalLength,
+        const double horizontalLength,
+        const double radius,
+        double angle,
+        const Density &density
+    ){
+        conn::reserveSpace(path.segments, 7);
+
+        angle += conn::pi;
+
+        double rotationAngle = -0.5 * conn::pi;
+
+        conn::sector(
+            path, radius, angle, angle + rotationAngle, density
+        );
+
+        angle += 2. * rotationAngle;
+
+        conn::line(path, verticalLength, angle, density);
+
+        angle -= rotationAngle;
+        rotationAngle *= 3.;
+
+        conn::sector(
+            path, radius, angle, angle + rotationAngle, density
+        );
+
+        conn::line(path, horizontalLength, angle, density);
+
+        angle += -rotationAngle / 3.;
+
+        conn::sector(
+            path, radius, angle, angle + rotationAngle, density
+        );
+
+        conn::line(path, verticalLength, angle, density);
+
+        rotationAngle /= 3.;
+        angle -= rotationAngle;
+
+        conn::sector(
+            path, radius, angle, angle + rotationAngle, density
+        );
+    }
+
+    /// \fn template<typename Allocator, typename Density> void 
+    /// letterPi(std::vector<LocalPoint, Allocator> &points, const double 
+    /// verticalLength, const double horizontalLength, const double radius, 
+    /// double angle, const Density &density);
+    /// \brief Calculates points that form a letter pi
+    /// \details This function calculates points that form something that looks 
+    /// close to a pi letter
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param verticalLength Length of the vertical line segment in meters
+    /// \param horizontalLength Length of the horizontal line segment in meters
+    /// \param radius Radius of the round segment in meters
+    /// \param angle Initial angle of the letter in radians
+    /// \param density Number of points per elementary figure or their Sampling
+    template<typename Allocator, typename Density>
+    INLINE void letterPi(
+        std::vector<conn::LocalPoint, Allocator> &points,
+        const double verticalLength,
+        const double horizontalLength,
+        const double radius,
+        double angle,
+        const Density &density
+    ){
+        conn::Path path(
+            points[points.size() - 1],
+            conn::arenaOf(points.get_allocator())
+        );
+
+        conn::letterPi(
+            path,
+            verticalLength,
+            horizontalLength,
+            radius,
+            angle,
+            density
+        );
+        conn::appendPoints(points, path);
+    }
+
+    /// \fn void letterPi( std::vector< std::vector<double> > &points, const 
+    /// double verticalLength, const double horizontalLength, const double 
+    /// radius, double angle, const std::size_t numberOfPoints);
+    /// \brief Calculates points that form a letter pi
+    /// \details This function calculates points that form something that looks 
+    /// close to a pi letter
+    /// \param points List to add points (should already has an initial 
+    /// point - a pole)
+    /// \param verticalLength Length of the vertical line segment in meters
+    /// \param horizontalLength Length of the horizontal line segment in meters
+    /// \param radius Radius of the round segment in meters
+    /// \param angle Initial angle of the letter in radians
+    /// \param numberOfPoints Number of points per elementary figure
+    INLINE void letterPi(
+        std::vector< std::vector<double> > &points,
+        const double verticalLength,
+        const double horizontalLength,
+        const double radius,
+        double angle,
+        const std::size_t numberOfPoints
+    ){
+        std::vector<conn::LocalPoint> localPoints = conn::localPointsFromPole(
+            points
+        );
+
+        conn::letterPi(
+            localPoints,
+            verticalLength,
+            horizontalLength,
+            radius,
+            angle,
+            numberOfPoints
+        );
+        conn::appendLocalPoints(points, localPoints);
+    }
+
+    /// \} End of TrackFunctions Group
+
+    /// \defgroup SimplificationFunctions Simplification Functions
+    /// \brief Functions decimating tracks
+    /// \details Group of functions that remove points of a track which do 
+    /// not change its shape by more than a tolerance, e.g. before sending it 
+    /// over a slow link. Local points are treated as a polyline in the 
+    /// plane, geographic points as a chain of great circle arcs. The first 
+    /// and last points are always kept
+    /// \{
+
+    /// \fn double distanceToSegment(const LocalPoint point, const LocalPoint 
+    /// start, const LocalPoint finish);
+    /// \brief Calculates distance from a point to a line segment
+    /// \details This function calculates the distance from a point to the 
+    /// nearest point of a line segment in the plane
+    /// \param point Point to measure from
+    /// \param start Start of the segment
+    /// \param finish Finish of the segment
+    /// \return Distance in meters
+    INLINE double distanceToSegment(
+        const conn::LocalPoint point,
+        const conn::LocalPoint start,
+        const conn::LocalPoint finish
+    ){
+        const double dx = finish.x - start.x;
+        const double dy = finish.y - start.y;
+        const double squaredLength = dx * dx + dy * dy;
+
+        double cut = 0.;
+
+        if(0. < squaredLength){
+            cut = ((point.x - start.x) * dx + (point.y - start.y) * dy)
+                / squaredLength;
+            cut = std::min(1., std::max(0., cut));
+        }
+
+        const double x = point.x - start.x - cut * dx;
+        const double y = point.y - start.y - cut * dy;
+
+        return sqrt(x * x + y * y);
+    }
+
+    /// \fn double distanceToSegment(const GeoPoint point, const GeoPoint 
+    /// start, const GeoPoint finish, const double radius = earthRadius);
+    /// \brief Calculates distance from a point to a great circle arc
+    /// \details This function calculates the distance along the great circle 
+    /// from a point to the nearest point of the shorter arc between two 
+    /// points. It uses unit vectors, so it has no trouble near the poles or 
+    /// the antimeridian
+    /// \param point Point to measure from (in degrees)
+    /// \param start Start of the arc (in degrees)
+    /// \param finish Finish of the arc (in degrees)
+    /// \param radius Optional. Earth radius. Average radius by default
+    /// \return Distance in meters
+    INLINE double distanceToSegment(
+        const conn::GeoPoint point,
+        const conn::GeoPoint start,
+        const conn::GeoPoint finish,
+        const double radius = conn::earthRadius
+    ){
+        struct Vector{
+            double x;
+            double y;
+            double z;
+        };
+
+        const auto unitVector = [](const conn::GeoPoint income){
+            const double latitude = conn::radiansFromDegrees(income.latitude);
+            const double longitude = conn::radiansFromDegrees(
+                income.longitude
+            );
+
+            return Vector{
+                cos(latitude) * cos(longitude),
+                cos(latitude) * sin(longitude),
+                sin(latitude)
+            };
+        };
+        const auto cross = [](const Vector first, const Vector second){
+            return Vector{
+                first.y * second.z - first.z * second.y,
+                first.z * second.x - first.x * second.z,
+                first.x * second.y - first.y * second.x
+            };
+        };
+        const auto dot = [](const Vector first, const Vector second){
+            return first.x * second.x + first.y * second.y
+                + first.z * second.z;
+        };
+        const auto angle = [&](const Vector first, const Vector second){
+            const Vector normal = cross(first, second);
+
+            return atan2(sqrt(dot(normal, normal)), dot(first, second));
+        };
+
+        const Vector p = unitVector(point);
+        const Vector a = unitVector(start);
+        const Vector b = unitVector(finish);
+        const Vector normal = cross(a, b);
+        const double normalLength = sqrt(dot(normal, normal));
+
+        if(0. < normalLength){
+            const Vector aToP = cross(a, p);
+            const Vector pToB = cross(p, b);
+
+            if(0. <= dot(aToP, normal) && 0. <= dot(pToB, normal)){
+                return radius * std::fabs(
+                    asin(std::min(1., dot(p, normal) / normalLength))
+                );
+            }
+        }
+
+        return radius * std::min(angle(p, a), angle(p, b));
+    }
+
+    /// \fn template<typename Point, typename Distance> std::vector<char> 
+    /// douglasPeuckerMask(const std::vector<Point> &points, const double 
+    /// tolerance, const Distance &distance);
+    /// \brief Marks points kept by Douglas-Peucker algorithm
+    /// \details This function runs Douglas-Peucker algorithm with an 
+    /// explicit stack instead of recursion, so long tracks can not overflow 
+    /// the call stack. It takes O(n log n) time on usual tracks and O(n^2) in 
+    /// the worst case
+    /// \param points Points of the track
+    /// \param tolerance Largest distance of a removed point to the result
+    /// \param distance Function giving the distance from a point to a segment
+    /// \return One flag per point, nonzero if the point is kept
+    template<typename Point, typename Distance>
+    INLINE std::vector<char> douglasPeuckerMask(
+        const std::vector<Point> &points,
+        const double tolerance,
+        const Distance &distance
+    ){
+        std::vector<char> isKept(points.size(), 0);
+
+        if(points.size() < 3){
+            std::fill(isKept.begin(), isKept.end(), 1);
+
+            return isKept;
+        }
+
+        isKept.front() = 1;
+        isKept.back() = 1;
+
+        std::vector< std::pair<std::size_t, std::size_t> > ranges;
+        ranges.push_back(std::make_pair(0, points.size() - 1));
+
+        while(!ranges.empty()){
+            const std::size_t first = ranges.back().first;
+            const std::size_t last = ranges.back().second;
+            ranges.pop_back();
+
+            double largestDistance = -1.;
+            std::size_t farthest = first;
+
+            for(std::size_t i = first + 1; i < last; ++i){
+                const double current = distance(
+                    points[i],
+                    points[first],
+                    points[last]
+                );
+
+                if(current > largestDistance){
+                    largestDistance = current;
+                    farthest = i;
+                }
+            }
+
+            if(largestDistance > tolerance){
+                isKept[farthest] = 1;
+
+                if(farthest - first > 1){
+                    ranges.push_back(std::make_pair(first, farthest));
+                }
+
+                if(last - farthest > 1){
+                    ranges.push_back(std::make_pair(farthest, last));
+                }
+            }
+        }
+
+        return isKept;
+    }
+
+    /// \fn template<typename Point> std::vector<Point> 
+    /// pointsFromMask(const std::vector<Point> &points, const 
+    /// std::vector<char> &isKept);
+    /// \brief Collects marked points
+    /// \details This function copies the points with nonzero flags
+    /// \param points Points of the track
+    /// \param isKept One flag per point
+    /// \return Marked points in the same order
+    template<typename Point>
+    INLINE std::vector<Point> pointsFromMask(
+        const std::vector<Point> &points,
+        const std::vector<char> &isKept
+    ){
+        std::vector<Point> result;
+        result.reserve(std::count(isKept.begin(), isKept.end(), 1));
+
+        for(std::size_t i = 0; i < points.size(); ++i){
+            if(isKept[i]){
+                result.push_back(points[i]);
+            }
+        }
+
+        return result;
+    }
+
+    /// \fn std::vector<LocalPoint> douglasPeucker(const 
+    /// std::vector<LocalPoint> &points, const double tolerance);
+    /// \brief Simplifies a track with Douglas-Peucker algorithm
+    /// \details This function removes points of a track while each removed 
+    /// point stays within the tolerance of the result, see 
+    /// douglasPeuckerMask()
+    /// \param points Points of the track
+    /// \param tolerance Tolerance in meters
+    /// \return Kept points in the same order
+    INLINE std::vector<conn::LocalPoint> douglasPeucker(
+        const std::vector<conn::LocalPoint> &points,
+        const double tolerance
+    ){
+        return conn::pointsFromMask(
+            points,
+            conn::douglasPeuckerMask(
+                points,
+                tolerance,
+                [](
+                    const conn::LocalPoint point,
+                    const conn::LocalPoint start,
+                    const conn::LocalPoint finish
+                ){
+                    return conn::distanceToSegment(point, start, finish);
+                }
+            )
+        );
+    }
+
+    /// \fn std::vector<GeoPoint> douglasPeucker(const std::vector<GeoPoint> 
+    /// &points, const double tolerance, const bool 
+    /// shouldCalculateEarthRadius = false);
+    /// \brief Simplifies a track with Douglas-Peucker algorithm
+    /// \details This function removes points of a track while each removed 
+    /// point stays within the tolerance of the result along the great 
+    /// circle, see douglasPeuckerMask()
+    /// \param points Points of the track (in degrees)
+    /// \param tolerance Tolerance in meters
+    /// \param shouldCalculateEarthRadius True if Earth radius should be 
+    /// calculated for the first point using WSG-84 model, average radius is 
+    /// used otherwise.
+    /// \return Kept points in the same order
+    INLINE std::vector<conn::GeoPoint> douglasPeucker(
+        const std::vector<conn::GeoPoint> &points,
+        const double tolerance,
+        const bool shouldCalculateEarthRadius = false
+    ){
+        double radius = conn::earthRadius;
+
+        if(shouldCalculateEarthRadius && !points.empty()){
+            radius = conn::calculateEarthRadius(points.front().latitude);
+        }
+
+        return conn::pointsFromMask(
+            points,
+            conn::douglasPeuckerMask(
+                points,
+                tolerance,
+                [radius](
+                    const conn::GeoPoint point,
+                    const conn::GeoPoint start,
+                    const conn::GeoPoint finish
+                ){
+                    return conn::distanceToSegment(
+                        point,
+                        start,
+                        finish,
+                        radius
+                    );
+                }
+            )
+        );
+    }
+
+    /// \fn template<typename Point, typename Area> std::vector<char> 
+    /// visvalingamMask(const std::vector<Point> &points, const double area, 
+    /// const Area &triangleArea);
+    /// \brief Marks points kept by Visvalingam-Whyatt algorithm
+    /// \details This function repeatedly removes the point that forms the 
+    /// smallest triangle with its neighbours until every triangle is at 
+    /// least \p area. The areas never decrease after a removal, as the 
+    /// algorithm requires. It takes O(n log n) time on any track
+    /// \param points Points of the track
+    /// \param area Smallest area of a triangle in square meters
+    /// \param triangleArea Function giving the area of a triangle
+    /// \return One flag per point, nonzero if the point is kept
+    template<typename Point, typename Area>
+    INLINE std::vector<char> visvalingamMask(
+        const std::vector<Point> &points,
+        const double area,
+        const Area &triangleArea
+    ){
+        const std::size_t numberOfPoints = points.size();
+        std::vector<char> isKept(numberOfPoints, 1);
+
+        if(numberOfPoints < 3){
+            return isKept;
+        }
+
+        std::vector<std::size_t> previous(numberOfPoints);
+        std::vector<std::size_t> next(numberOfPoints);
+        std::vector<double> areas(numberOfPoints, 0.);
+
+        const auto areaOf = [&](const std::size_t i){
+            return triangleArea(
+                points[previous[i]],
+                points[i],
+                points[next[i]]
+            );
+        };
+
+        typedef std::pair<double, std::size_t> Entry;
+        std::vector<Entry> heap;
+        heap.reserve(numberOfPoints);
+
+        for(std::size_t i = 1; i + 1 < numberOfPoints; ++i){
+            previous[i] = i - 1;
+            next[i] = i + 1;
+            areas[i] = areaOf(i);
+            heap.push_back(Entry(areas[i], i));
+        }
+
+        std::make_heap(heap.begin(), heap.end(), std::greater<Entry>());
+
+        while(!heap.empty()){
+            std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+            const Entry entry = heap.back();
+            heap.pop_back();
+
+            const std::size_t i = entry.second;
+
+            // Entries of removed points and old areas are skipped
+            if(!isKept[i] || entry.first != areas[i]){
+                continue;
+            }
+
+            if(entry.first >= area){
+                break;
+            }
+
+            isKept[i] = 0;
+
+            const std::size_t before = previous[i];
+            const std::size_t after = next[i];
+
+            next[before] = after;
+            previous[after] = before;
+
+            if(0 != before){
+                areas[before] = std::max(entry.first, areaOf(before));
+                heap.push_back(Entry(areas[before], before));
+                std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+            }
+
+            if(numberOfPoints - 1 != after){
+                areas[after] = std::max(entry.first, areaOf(after));
+                heap.push_back(Entry(areas[after], after));
+                std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+            }
+        }
+
+        return isKept;
+    }
+
+    /// \fn std::vector<LocalPoint> visvalingam(const std::vector<LocalPoint> 
+    /// &points, const double area);
+    /// \brief Simplifies a track with Visvalingam-Whyatt algorithm
+    /// \details This function removes points of a track while their 
+    /// triangles are smaller than \p area, see visvalingamMask(). It suits 
+    /// large tracks better than douglasPeucker(), but bounds the area 
+    /// instead of the distance. A triangle is half its base times its 
+    /// height, so removing a point between neighbours about s meters apart 
+    /// moves the track by about 2 * area / s meters: a tolerance of d meters 
+    /// corresponds to an area of about d * s / 2, e.g. 10 m^2 for 1 m at 
+    /// 20 m spacing
+    /// \param points Points of the track
+    /// \param area Smallest area of a triangle in square meters
+    /// \return Kept points in the same order
+    INLINE std::vector<conn::LocalPoint> visvalingam(
+        const std::vector<conn::LocalPoint> &points,
+        const double area
+    ){
+        return conn::pointsFromMask(
+            points,
+            conn::visvalingamMask(
+                points,
+                area,
+                [](
+                    const conn::LocalPoint a,
+                    const conn::LocalPoint b,
+                    const conn::LocalPoint c
+                ){
+                    return 0.5 * std::fabs(
+                        (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)
+                    );
+                }
+            )
+        );
+    }
+
+    /// \fn std::vector<GeoPoint> visvalingam(const std::vector<GeoPoint> 
+    /// &points, const double area, const bool shouldCalculateEarthRadius = 
+    /// false);
+    /// \brief Simplifies a track with Visvalingam-Whyatt algorithm
+    /// \details This function removes points of a track while their 
+    /// triangles are smaller than \p area, see visvalingamMask(). Each 
+    /// triangle is measured in an equirectangular plane at its middle 
+    /// point, so it is off by about the relative change of the cosine of 
+    /// latitude across the triangle, and works across the antimeridian. 
+    /// The area maps to meters as in the 
+    /// LocalPoint overload: about d * s / 2 for a tolerance of d meters 
+    /// between points s meters apart
+    /// \param points Points of the track (in degrees)
+    /// \param area Smallest area of a triangle in square meters
+    /// \param shouldCalculateEarthRadius True if Earth radius should be 
+    /// calculated for the first point using WSG-84 model, average radius is 
+    /// used otherwise.
+    /// \return Kept points in the same order
+    INLINE std::vector<conn::GeoPoint> visvalingam(
+        const std::vector<conn::GeoPoint> &points,
+        const double area,
+        const bool shouldCalculateEarthRadius = false
+    ){
+        double radius = conn::earthRadius;
+
+        if(shouldCalculateEarthRadius && !points.empty()){
+            radius = conn::calculateEarthRadius(points.front().latitude);
+        }
+
+        const double metersPerDegree = conn::radiansFromDegrees(radius);
+
+        return conn::pointsFromMask(
+            points,
+            conn::visvalingamMask(
+                points,
+                area,
+                [metersPerDegree](
+                    const conn::GeoPoint a,
+                    const conn::GeoPoint b,
+                    const conn::GeoPoint c
+                ){
+                    const double scale = cos(
+                        conn::radiansFromDegrees(b.latitude)
+                    );
+                    const double ax = scale * conn::longitudeDifference(
+                        b.longitude,
+                        a.longitude
+                    );
+                    const double cx = scale * conn::longitudeDifference(
+                        b.longitude,
+                        c.longitude
+                    );
+                    const double ay = a.latitude - b.latitude;
+                    const double cy = c.latitude - b.latitude;
+
+                    return 0.5 * metersPerDegree * metersPerDegree
+                        * std::fabs(ax * cy - cx * ay);
+                }
+            )
+        );
+    }
+
+    /// \class StreamingSimplifier
+    /// \brief Incremental track simplifier
+    /// \details Simplifies a track while its points arrive, e.g. from 
+    /// forEachPoint(), and passes the kept points to a function right away. 
+    /// It grows a window from the last kept point and keeps the previous 
+    /// point once some point of the window gets farther than the tolerance 
+    /// from the line to the new one, so each removed point stays within the 
+    /// tolerance of the result, as with douglasPeucker(). The window is 
+    /// limited, which bounds memory and makes the time linear, at the cost 
+    /// of a few more points than douglasPeucker() keeps. Point is LocalPoint 
+    /// or GeoPoint, see distanceToSegment(); use makeStreamingSimplifier() to 
+    /// create one
+    template<typename Point, typename Function>
+    class StreamingSimplifier{
+        public:
+            /// \brief Creates a simplifier
+            /// \param tolerance Tolerance in meters
+            /// \param function Function to call with each kept point
+            /// \param maximumWindow Optional. Largest number of points 
+            /// between two kept ones. 64 by default
+            StreamingSimplifier(
+                const double tolerance,
+                Function function,
+                const std::size_t maximumWindow = 64
+            ) : tolerance(tolerance),
+                function(function),
+                maximumWindow(std::max<std::size_t>(maximumWindow, 2)){
+                this->window.reserve(this->maximumWindow + 1);
+            }
+
+            /// \brief Accepts the next point of the track
+            /// \details Passes the point that ends the previous piece of the 
+            /// result to the function, if the new point starts a new one
+            /// \param point Next point
+            void push(const Point &point){
+                if(this->window.empty()){
+                    this->window.push_back(point);
+                    this->function(point);
+
+                    return;
+                }
+
+                bool fits = this->window.size() <= this->maximumWindow;
+
+                for(std::size_t i = 1; fits && i < this->window.size(); ++i){
+                    fits = conn::distanceToSegment(
+                        this->window[i],
+                        this->window.front(),
+                        point
+                    ) <= this->tolerance;
+                }
+
+                if(!fits){
+                    const Point anchor = this->window.back();
+
+                    this->function(anchor);
+                    this->window.clear();
+                    this->window.push_back(anchor);
+                }
+
+                this->window.push_back(point);
+            }
+
+            /// \brief Finishes the track
+            /// \details Passes the last point to the function. The simplifier 
+            /// can start a new track afterwards
+            void finish(){
+                if(1 < this->window.size()){
+                    this->function(this->window.back());
+                }
+
+                this->window.clear();
+            }
+
+        private:
+            double tolerance;
+            Function function;
+            std::size_t maximumWindow;
+            std::vector<Point> window;
+    };
+
+    /// \fn template<typename Point, typename Function> 
+    /// StreamingSimplifier<Point, Function> makeStreamingSimplifier(const 
+    /// double tolerance, Function function, const std::size_t maximumWindow 
+    /// = 64);
+    /// \brief Creates a streaming simplifier
+    /// \details This function creates a StreamingSimplifier, so the type of 
+    /// \p function (e.g. a lambda) is deduced
+    /// \param tolerance Tolerance in meters
+    /// \param function Function to call with each kept point
+    /// \param maximumWindow Optional. Largest number of points between two 
+    /// kept ones. 64 by default
+    /// \return Simplifier
+    template<typename Point, typename Function>
+    INLINE conn::StreamingSimplifier<Point, Function> makeStreamingSimplifier(
+        const double tolerance,
+        Function function,
+        const std::size_t maximumWindow = 64
+    ){
+        return conn::StreamingSimplifier<Point, Function>(
+            tolerance,
+            function,
+            maximumWindow
+        );
+    }
+
+    /// \} End of SimplificationFunctions Group
+
+    /// \defgroup PlanningFunctions Planning Functions
+    /// \brief Classes projecting paths in the background
+    /// \details Group of classes that project points of a path to 
+    /// geographic points on an executor and hand them over in chunks as 
+    /// they are produced, so a service planning many missions does not 
+    /// block its event loop on a long projection and can upload a chunk 
+    /// while the next one is calculated
+    /// \{
+
+    /// \brief Default number of points of a WaypointChunk
+    constexpr std::size_t planChunkSize = 4096;
+
+    /// \brief Executor running the tasks of the lib
+    /// \details Function that runs a task on some thread, e.g. posts it to a 
+    /// thread pool. The task runs until the job is finished or cancelled 
+    /// and waits for the consumer while the queue is full, so it should not 
+    /// run on the thread of the consumer
+    typedef std::function<void(std::function<void()>)> Executor;
+
+    /// \struct WaypointChunk
+    /// \brief Consecutive geographic points of a path
+    struct WaypointChunk{
+        /// \brief Index of the first point in the path (the start point of 
+        /// the path is not counted, see fillPoints())
+        std::size_t offset;
+
+        /// \brief Latitudes of the points (in degrees)
+        std::vector<double> latitudes;
+
+        /// \brief Longitudes of the points (in degrees)
+        std::vector<double> longitudes;
+    };
+
+    /// \class PlanStream
+    /// \brief Chunks of a path projected in the background
+    /// \details Handle of a job started by planAsync(). Chunks are queued in 
+    /// order until the consumer takes them, the job waits while the queue 
+    /// is full, so at most a few chunks are kept in memory. Destroying the 
+    /// last handle cancels the job. A handle left empty by a move has no 
+    /// job: it gives no chunks and is done
+    class PlanStream{
+        public:
+            /// \brief Shared state of a job
+            /// \details Use planAsync() instead of this type
+            struct State{
+                /// \brief Path to project, it does not use any arena
+                conn::Path path;
+
+                /// \brief Geographic point of the local point (0, 0)
+                conn::GeoPoint origin;
+
+                /// \brief Earth radius used for the projection
+                double radius;
+
+                /// \brief Number of points of a chunk
+                std::size_t chunkSize;
+
+                /// \brief Largest number of chunks in the queue
+                std::size_t maximumQueuedChunks;
+
+                /// \brief Guard of the fields below
+                std::mutex mutex;
+
+                /// \brief Signal of a change of the queue or the flags
+                std::condition_variable condition;
+
+                /// \brief Chunks not taken yet
+                std::deque<conn::WaypointChunk> queue;
+
+                /// \brief True if the job has finished
+                bool isFinished;
+
+                /// \brief Exception thrown by the job
+                std::exception_ptr exception;
+
+                /// \brief True if the job was cancelled
+                std::atomic<bool> isCancelled;
+
+                /// \brief Number of projected points when the job finishes
+                std::promise<std::size_t> completion;
+
+                /// \brief Creates a state of a job
+                /// \param path Path to project
+                /// \param origin Geographic point of the local point (0, 0)
+                /// \param radius Earth radius
+                /// \param chunkSize Number of points of a chunk
+                /// \param maximumQueuedChunks Largest number of chunks in 
+                /// the queue
+                State(
+                    const conn::Path &path,
+                    const conn::GeoPoint origin,
+                    const double radius,
+                    const std::size_t chunkSize,
+                    const std::size_t maximumQueuedChunks
+                ) : path(path.start),
+                    origin(origin),
+                    radius(radius),
+                    chunkSize(std::max<std::size_t>(1, chunkSize)),
+                    maximumQueuedChunks(
+                        std::max<std::size_t>(1, maximumQueuedChunks)
+                    ),
+                    isFinished(false),
+                    isCancelled(false){
+                    this->path.segments.assign(
+                        path.segments.begin(),
+                        path.segments.end()
+                    );
+                }
+
+                /// \brief Projects the path and queues its chunks
+                void run(){
+                    std::size_t offset = 0;
+
+                    try{
+                        const double latitude = conn::radiansFromDegrees(
+                            this->origin.latitude
+                        );
+                        const double sinLatitude = std::sin(latitude);
+                        const double cosLatitude = std::cos(latitude);
+                        const conn::PathIterator end = this->path.end();
+                        conn::PathIterator point = this->path.begin();
+
+                        while(point != end && !this->isCancelled){
+                            conn::WaypointChunk chunk;
+
+                            chunk.offset = offset;
+                            chunk.latitudes.reserve(this->chunkSize);
+                            chunk.longitudes.reserve(this->chunkSize);
+
+                            for(
+                                std::size_t i = 0;
+                                i < this->chunkSize && point != end;
+                                ++i, ++point
+                            ){
+                                const conn::LocalPoint local = *point;
+                                const conn::GeoPoint next =
+                                    conn::destinationByAngles(
+                                        this->origin,
+                                        sinLatitude,
+                                        cosLatitude,
+                                        std::sqrt(
+                                            local.x * local.x
+                                            + local.y * local.y
+                                        ) / this->radius,
+                                        conn::kernelAtan2(local.x, local.y)
+                                    );
+
+                                chunk.latitudes.push_back(next.latitude);
+                                chunk.longitudes.push_back(next.longitude);
+                            }
+
+                            std::unique_lock<std::mutex> lock(this->mutex);
+
+                            this->condition.wait(lock, [&](){
+                                return this->isCancelled
+                                    || this->queue.size()
+                                        < this->maximumQueuedChunks;
+                            });
+
+                            if(this->isCancelled){
+                                break;
+                            }
+
+                            offset += chunk.latitudes.size();
+                            this->queue.push_back(std::move(chunk));
+                            lock.unlock();
+                            this->condition.notify_all();
+                        }
+                    }catch(...){
+                        std::lock_guard<std::mutex> lock(this->mutex);
+
+                        this->exception = std::current_exception();
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(this->mutex);
+
+                        this->isFinished = true;
+                    }
+
+                    this->condition.notify_all();
+
+                    if(this->exception){
+                        this->completion.set_exception(this->exception);
+                    }else{
+                        this->completion.set_value(offset);
+                    }
+                }
+            };
+
+            /// \brief Creates a handle of a job
+            /// \param state Shared state of the job
+            explicit PlanStream(const std::shared_ptr<State> &state)
+                : state(state),
+                completion(state->completion.get_future().share()){}
+
+            PlanStream(const conn::PlanStream &) = delete;
+
+            conn::PlanStream &operator=(const conn::PlanStream &) = delete;
+
+            /// \brief Takes over a job
+            /// \param other Handle to take over, it is left empty
+            PlanStream(conn::PlanStream &&other)
+                : state(std::move(other.state)),
+                completion(std::move(other.completion)){}
+
+            /// \brief Takes over a job
+            /// \param other Handle to take over, it is left empty
+            /// \return This handle
+            conn::PlanStream &operator=(conn::PlanStream &&other){
+                if(this != &other){
+                    this->cancel();
+                    this->state = std::move(other.state);
+                    this->completion = std::move(other.completion);
+                }
+
+                return *this;
+            }
+
+            /// \brief Cancels the job
+            ~PlanStream(){
+                this->cancel();
+            }
+
+            /// \brief Takes the next chunk if it is ready
+            /// \details This function never waits, so it can be polled from 
+            /// an event loop
+            /// \param chunk Chunk to fill
+            /// \return True if \p chunk was filled, false if it is not 
+            /// ready or the handle is empty
+            /// \exception Any exception thrown by the job once all chunks 
+            /// produced before it are taken
+            bool tryNext(conn::WaypointChunk &chunk){
+                if(!this->state){
+                    return false;
+                }
+
+                std::unique_lock<std::mutex> lock(this->state->mutex);
+
+                return this->take(lock, chunk);
+            }
+
+            /// \brief Takes the next chunk
+            /// \details This function waits until the next chunk is ready or 
+            /// the job is finished
+            /// \param chunk Chunk to fill
+            /// \return True if \p chunk was filled, false if there are no 
+            /// more chunks or the handle is empty
+            /// \exception Any exception thrown by the job once all chunks 
+            /// produced before it are taken
+            bool next(conn::WaypointChunk &chunk){
+                if(!this->state){
+                    return false;
+                }
+
+                std::unique_lock<std::mutex> lock(this->state->mutex);
+
+                this->state->condition.wait(lock, [&](){
+                    return !this->state->queue.empty()
+                        || this->state->isFinished;
+                });
+
+                return this->take(lock, chunk);
+            }
+
+            /// \brief Checks if the job has finished and all chunks are taken
+            /// \return True if no more chunks will come, also if the handle 
+            /// is empty
+            bool isDone() const{
+                if(!this->state){
+                    return true;
+                }
+
+                std::lock_guard<std::mutex> lock(this->state->mutex);
+
+                return this->state->isFinished && this->state->queue.empty();
+            }
+
+            /// \brief Stops the job
+            /// \details The job stops before its next chunk, the chunks in 
+            /// the queue can still be taken
+            void cancel(){
+                if(!this->state){
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(this->state->mutex);
+
+                    this->state->isCancelled = true;
+                }
+
+                this->state->condition.notify_all();
+            }
+
+            /// \brief Checks if the job was cancelled
+            /// \return True if cancel() was called, false if the handle is 
+            /// empty
+            bool isCancelled() const{
+                return this->state && this->state->isCancelled;
+            }
+
+            /// \brief Gets the result of the job
+            /// \details Future of the number of points the job has queued, 
+            /// ready when the job finishes (also if it was cancelled). It 
+            /// holds the exception if the job has thrown one
+            /// \return Future of the number of points, not valid if the 
+            /// handle is empty
+            std::shared_future<std::size_t> getCompletion() const{
+                return this->completion;
+            }
+
+        private:
+            bool take(
+                std::unique_lock<std::mutex> &lock,
+                conn::WaypointChunk &chunk
+            ){
+                if(!this->state->queue.empty()){
+                    chunk = std::move(this->state->queue.front());
+                    this->state->queue.pop_front();
+                    lock.unlock();
+                    this->state->condition.notify_all();
+
+                    return true;
+                }
+
+                if(this->state->isFinished && this->state->exception){
+                    std::rethrow_exception(this->state->exception);
+                }
+
+                return false;
+            }
+
+            std::shared_ptr<State> state;
+            std::shared_future<std::size_t> completion;
+    };
+
+    /// \fn PlanStream planAsync(const Path &path, const GeoPoint origin, 
+    /// const Executor &executor = Executor(), const std::size_t chunkSize = 
+    /// planChunkSize, const std::size_t maximumQueuedChunks = 4, const bool 
+    /// shouldCalculateEarthRadius = false);
+    /// \brief Starts projecting a path in the background
+    /// \details This function copies a path (e.g. built by squiggle() or 
+    /// letterPi()) and projects its points to geographic points the same 
+    /// way as projectPath() does, in a task run by \p executor. The points 
+    /// come in chunks from the returned stream in order. The start point is 
+    /// not projected
+    /// \param path Path to project, it may be destroyed after the call
+    /// \param origin Geographic point of the local point (0, 0) (in degrees)
+    /// \param executor Optional. Executor to run the job, a new detached 
+    /// thread is used if it is empty. Empty by default
+    /// \param chunkSize Optional. Number of points of a chunk, the last one 
+    /// may be shorter. planChunkSize by default
+    /// \param maximumQueuedChunks Optional. Largest number of chunks waiting 
+    /// for the consumer. 4 by default
+    /// \param shouldCalculateEarthRadius Optional. True if Earth radius 
+    /// should be calculated for the origin using WSG-84 model, average radius 
+    /// is used otherwise. False by default
+    /// \return Stream of chunks
+    INLINE conn::PlanStream planAsync(
+        const conn::Path &path,
+        const conn::GeoPoint origin,
+        const conn::Executor &executor = conn::Executor(),
+        const std::size_t chunkSize = conn::planChunkSize,
+        const std::size_t maximumQueuedChunks = 4,
+        const bool shouldCalculateEarthRadius = false
+    ){
+        const std::shared_ptr<conn::PlanStream::State> state =
+            std::make_shared<conn::PlanStream::State>(
+                path,
+                origin,
+                shouldCalculateEarthRadius
+                    ? conn::calculateEarthRadius(origin.latitude)
+                    : conn::earthRadius,
+                chunkSize,
+                maximumQueuedChunks
+            );
+        conn::PlanStream stream(state);
+        const std::function<void()> task = [state](){
+            state->run();
+        };
+
+        if(executor){
+            executor(task);
+        }else{
+            std::thread(task).detach();
+        }
+
+        return stream;
+    }
+
+    /// \} End of PlanningFunctions Group
+
+    /// \defgroup IndexFunctions Index Functions
+    /// \brief Classes finding waypoints near a point
+    /// \details Group of classes that index geographic points, so the 
+    /// nearest waypoints to a fix are found without measuring the distance 
+    /// to every one of them
+    /// \{
+
+    /// \struct WaypointMatch
+    /// \brief Waypoint found by a query
+    /// \details Index of a waypoint in WaypointIndex and its great circle 
+    /// distance to the query point
+    struct WaypointMatch{
+        /// \brief Index of the waypoint
+        std::size_t index;
+
+        /// \brief Distance in meters
+        double distance;
+    };
+
+    /// \class WaypointIndex
+    /// \brief Spatial index of waypoints
+    /// \details Keeps waypoints as unit vectors in a uniform grid of cubes 
+    /// hashed by their coordinates. Unit vectors have no trouble near the 
+    /// poles or the antimeridian, and the chord between two of them grows 
+    /// with the great circle distance, so cubes are searched outwards from 
+    /// the cube of the query point until nothing closer can remain. Queries 
+    /// touch a few cubes when the cube size is about the spacing of the 
+    /// waypoints. Waypoints are numbered in the order of insertion and can 
+    /// be added at any time
+    class WaypointIndex{
+        public:
+            /// \brief Creates an empty index
+            /// \param cellSize Optional. Edge of a cube in meters. 100 m by 
+            /// default
+            /// \param radius Optional. Earth radius. Average radius by 
+            /// default
+            explicit WaypointIndex(
+                const double cellSize = 100.,
+                const double radius = conn::earthRadius
+            ) : radius(radius),
+                cellSize(std::max(cellSize, 1e-3) / radius){
+            }
+
+            /// \brief Gets a number of waypoints
+            /// \return Number of waypoints
+            std::size_t size() const{
+                return this->points.size();
+            }
+
+            /// \brief Gets a waypoint
+            /// \param index Index of the waypoint
+            /// \return Waypoint (in degrees)
+            conn::GeoPoint getPoint(const std::size_t index) const{
+                return this->points[index];
+            }
+
+            /// \brief Reserves space for waypoints
+            /// \param numberOfPoints Total number of waypoints
+            void reserve(const std::size_t numberOfPoints){
+                this->points.reserve(numberOfPoints);
+                this->vectors.reserve(numberOfPoints);
+            }
+
+            /// \brief Adds a waypoint
+            /// \param point Waypoint (in degrees)
+            /// \return Index of the waypoint
+            std::size_t insert(const conn::GeoPoint point){
+                const std::size_t index = this->points.size();
+                const Vector vector = unitVector(point);
+
+                this->points.push_back(point);
+                this->vectors.push_back(vector);
+                this->cells[this->cellOf(vector)].push_back(index);
+
+                return index;
+            }
+
+            /// \brief Adds waypoints
+            /// \details Takes arrays such as written by destinations() or 
+            /// projectPath()
+            /// \param latitudes Latitudes of the waypoints (in degrees)
+            /// \param longitudes Longitudes of the waypoints (in degrees)
+            /// \param numberOfPoints Number of waypoints
+            void insert(
+                const double *latitudes,
+                const double *longitudes,
+                const std::size_t numberOfPoints
+            ){
+                this->reserve(this->points.size() + numberOfPoints);
+
+                for(std::size_t i = 0; i < numberOfPoints; ++i){
+                    this->insert(
+                        conn::GeoPoint{latitudes[i], longitudes[i]}
+                    );
+                }
+            }
+
+            /// \brief Adds waypoints given as local points
+            /// \details Takes points built by track functions, e.g. 
+            /// squiggle(), and projects each one to the point at its 
+            /// distance and bearing from the origin, as projectPath() does 
+            /// with the radius of the index
+            /// \param origin Geographic point of the local point (0, 0) (in 
+            /// degrees)
+            /// \param localPoints Local points in meters
+            void insert(
+                const conn::GeoPoint origin,
+                const std::vector< std::vector<double> > &localPoints
+            ){
+                const double latitude = conn::radiansFromDegrees(
+                    origin.latitude
+                );
+                const double sinLatitude = sin(latitude);
+                const double cosLatitude = cos(latitude);
+
+                this->reserve(this->points.size() + localPoints.size());
+
+                for(const std::vector<double> &point : localPoints){
+                    this->insertLocalPoint(
+                        origin,
+                        sinLatitude,
+                        cosLatitude,
+                        conn::LocalPoint{point.at(0), point.at(1)}
+                    );
+                }
+            }
+
+            /// \brief Adds waypoints given as local points
+            /// \details Projects each point to the point at its distance and 
+            /// bearing from the origin, as projectPath() does with the radius 
+            /// of the index
+            /// \param origin Geographic point of the local point (0, 0) (in 
+            /// degrees)
+            /// \param localPoints Local points in meters
+            void insert(
+                const conn::GeoPoint origin,
+                const std::vector<conn::LocalPoint> &localPoints
+            ){
+                const double latitude = conn::radiansFromDegrees(
+                    origin.latitude
+                );
+                const double sinLatitude = sin(latitude);
+                const double cosLatitude = cos(latitude);
+
+                this->reserve(this->points.size() + localPoints.size());
+
+                for(const conn::LocalPoint point : localPoints){
+                    this->insertLocalPoint(
+                        origin,
+                        sinLatitude,
+                        cosLatitude,
+                        point
+                    );
+                }
+            }
+
+            /// \brief Adds points of a path
+            /// \details Calculates points of a path one by one and projects 
+            /// each of them as projectPath() does with the radius of the 
+            /// index, without buffers. The start point is not added
+            /// \param origin Geographic point of the local point (0, 0) (in 
+            /// degrees)
+            /// \param path Path to use
+            void insert(const conn::GeoPoint origin, const conn::Path &path){
+                const double latitude = conn::radiansFromDegrees(
+                    origin.latitude
+                );
+                const double sinLatitude = sin(latitude);
+                const double cosLatitude = cos(latitude);
+
+                this->reserve(this->points.size() + conn::countPoints(path));
+
+                conn::forEachPoint(path, [&](const conn::LocalPoint point){
+                    this->insertLocalPoint(
+                        origin,
+                        sinLatitude,
+                        cosLatitude,
+                        point
+                    );
+                });
+            }
+
+            /// \brief Finds the nearest waypoints
+            /// \details Writes the matches to a buffer given by the caller 
+            /// and keeps them there as a heap while searching, so the query 
+            /// allocates nothing
+            /// \param point Query point (in degrees)
+            /// \param numberOfMatches Largest number of waypoints to find
+            /// \param matches Buffer for at least \p numberOfMatches 
+            /// waypoints, written sorted by distance, nearest first
+            /// \return Number of waypoints found, the lesser of \p 
+            /// numberOfMatches and size()
+            std::size_t nearest(
+                const conn::GeoPoint point,
+                const std::size_t numberOfMatches,
+                conn::WaypointMatch *matches
+            ) const{
+                if(numberOfMatches == 0 || this->points.empty()){
+                    return 0;
+                }
+
+                const auto isCloser = [](
+                    const conn::WaypointMatch &first,
+                    const conn::WaypointMatch &second
+                ){
+                    return first.distance < second.distance || (
+                        first.distance == second.distance
+                        && first.index < second.index
+                    );
+                };
+                const Vector vector = unitVector(point);
+                const Cell center = this->cellOf(vector);
+                const double margin = this->marginInCell(vector, center);
+                std::size_t numberOfFound = 0;
+                const auto visit = [&](const std::vector<std::size_t> &cell){
+                    for(const std::size_t index : cell){
+                        const double chord = squaredChord(
+                            vector,
+                            this->vectors[index]
+                        );
+
+                        if(numberOfFound < numberOfMatches){
+                            matches[numberOfFound++] = conn::WaypointMatch{
+                                index,
+                                chord
+                            };
+                            std::push_heap(
+                                matches,
+                                matches + numberOfFound,
+                                isCloser
+                            );
+                        }else if(chord < matches[0].distance){
+                            std::pop_heap(
+                                matches,
+                                matches + numberOfFound,
+                                isCloser
+                            );
+                            matches[numberOfFound - 1] = conn::WaypointMatch{
+                                index,
+                                chord
+                            };
+                            std::push_heap(
+                                matches,
+                                matches + numberOfFound,
+                                isCloser
+                            );
+                        }
+                    }
+                };
+
+                for(std::int64_t ring = 0; ; ++ring){
+                    const std::int64_t side = 2 * ring + 1;
+                    const std::int64_t numberOfRingCells = ring == 0
+                        ? 1
+                        : side * side * side - (side - 2) * (side - 2)
+                            * (side - 2);
+
+                    if(
+                        static_cast<std::int64_t>(this->cells.size())
+                        < numberOfRingCells
+                    ){
+                        for(const auto &cell : this->cells){
+                            if(ring <= distanceOfCells(center, cell.first)){
+                                visit(cell.second);
+                            }
+                        }
+
+                        break;
+                    }
+
+                    this->forEachCellOfRing(center, ring, visit);
+
+                    const double reach = ring * this->cellSize + margin;
+
+                    if(
+                        (
+                            numberOfFound == numberOfMatches
+                            && matches[0].distance <= reach * reach
+                        ) || 2. < reach
+                    ){
+                        break;
+                    }
+                }
+
+                std::sort_heap(matches, matches + numberOfFound, isCloser);
+
+                for(std::size_t i = 0; i < numberOfFound; ++i){
+                    matches[i].distance = this->distanceOfChord(
+                        matches[i].distance
+                    );
+                }
+
+                return numberOfFound;
+            }
+
+            /// \brief Finds the nearest waypoints
+            /// \param point Query point (in degrees)
+            /// \param numberOfMatches Largest number of waypoints to find
+            /// \return Waypoints sorted by distance, nearest first
+            std::vector<conn::WaypointMatch> nearest(
+                const conn::GeoPoint point,
+                const std::size_t numberOfMatches
+            ) const{
+                std::vector<conn::WaypointMatch> matches(
+                    std::min(numberOfMatches, this->size())
+                );
+
+                matches.resize(
+                    this->nearest(point, matches.size(), matches.data())
+                );
+
+                return matches;
+            }
+
+            /// \brief Finds the nearest waypoint
+            /// \param point Query point (in degrees)
+            /// \return Nearest waypoint. Its index is size() if the index is 
+            /// empty
+            conn::WaypointMatch nearest(const conn::GeoPoint point) const{
+                conn::WaypointMatch match{this->size(), HUGE_VAL};
+
+                this->nearest(point, 1, &match);
+
+                return match;
+            }
+
+            /// \brief Finds waypoints within a distance
+            /// \param point Query point (in degrees)
+            /// \param distance Largest distance in meters
+            /// \return Waypoints sorted by distance, nearest first
+            std::vector<conn::WaypointMatch> within(
+                const conn::GeoPoint point,
+                const double distance
+            ) const{
+                typedef std::pair<double, std::size_t> Candidate;
+
+                std::vector<Candidate> found;
+
+                if(distance < 0. || this->points.empty()){
+                    return this->matchesFrom(found);
+                }
+
+                const Vector vector = unitVector(point);
+                const double chord = 2. * sin(
+                    0.5 * std::min(distance / this->radius, conn::pi)
+                );
+                const double squaredReach = chord * chord;
+                const Cell first = this->cellOf(
+                    Vector{vector.x - chord, vector.y - chord, vector.z - chord}
+                );
+                const Cell last = this->cellOf(
+                    Vector{vector.x + chord, vector.y + chord, vector.z + chord}
+                );
+                const auto visit = [&](const std::vector<std::size_t> &cell){
+                    for(const std::size_t index : cell){
+                        const double squared = squaredChord(
+                            vector,
+                            this->vectors[index]
+                        );
+
+                        if(squared <= squaredReach){
+                            found.push_back(Candidate{squared, index});
+                        }
+                    }
+                };
+                const double numberOfBoxCells = (last.x - first.x + 1.)
+                    * (last.y - first.y + 1.) * (last.z - first.z + 1.);
+
+                if(static_cast<double>(this->cells.size()) < numberOfBoxCells){
+                    for(const auto &cell : this->cells){
+                        visit(cell.second);
+                    }
+                }else{
+                    for(std::int64_t x = first.x; x <= last.x; ++x){
+                        for(std::int64_t y = first.y; y <= last.y; ++y){
+                            for(std::int64_t z = first.z; z <= last.z; ++z){
+                                this->visitCell(Cell{x, y, z}, visit);
+                            }
+                        }
+                    }
+                }
+
+                std::sort(found.begin(), found.end());
+
+                return this->matchesFrom(found);
+            }
+
+        private:
+            struct Vector{
+                double x;
+                double y;
+                double z;
+            };
+
+            struct Cell{
+                std::int64_t x;
+                std::int64_t y;
+                std::int64_t z;
+
+                bool operator==(const Cell &other) const{
+                    return this->x == other.x && this->y == other.y
+                        && this->z == other.z;
+                }
+            };
+
+            struct CellHash{
+                std::size_t operator()(const Cell &cell) const{
+                    const std::uint64_t hash = (
+                        static_cast<std::uint64_t>(cell.x)
+                            * 0x9E3779B97F4A7C15ull
+                    ) ^ (
+                        static_cast<std::uint64_t>(cell.y)
+                            * 0xC2B2AE3D27D4EB4Full
+                    ) ^ (
+                        static_cast<std::uint64_t>(cell.z)
+                            * 0x165667B19E3779F9ull
+                    );
+
+                    return static_cast<std::size_t>(hash ^ (hash >> 32));
+                }
+            };
+
+            void insertLocalPoint(
+                const conn::GeoPoint origin,
+                const double sinLatitude,
+                const double cosLatitude,
+                const conn::LocalPoint point
+            ){
+                this->insert(
+                    conn::destinationByAngles(
+                        origin,
+                        sinLatitude,
+                        cosLatitude,
+                        sqrt(point.x * point.x + point.y * point.y)
+                            / this->radius,
+                        conn::kernelAtan2(point.x, point.y)
+                    )
+                );
+            }
+
+            static Vector unitVector(const conn::GeoPoint point){
+                const double latitude = conn::radiansFromDegrees(
+                    point.latitude
+                );
+                const double longitude = conn::radiansFromDegrees(
+                    point.longitude
+                );
+
+                return Vector{
+                    cos(latitude) * cos(longitude),
+                    cos(latitude) * sin(longitude),
+                    sin(latitude)
+                };
+            }
+
+            static double squaredChord(
+                const Vector first,
+                const Vector second
+            ){
+                const double x = first.x - second.x;
+                const double y = first.y - second.y;
+                const double z = first.z - second.z;
+
+                return x * x + y * y + z * z;
+            }
+
+            static std::int64_t distanceOfCells(
+                const Cell first,
+                const Cell second
+            ){
+                return std::max(
+                    std::abs(first.x - second.x),
+                    std::max(
+                        std::abs(first.y - second.y),
+                        std::abs(first.z - second.z)
+                    )
+                );
+            }
+
+            Cell cellOf(const Vector vector) const{
+                return Cell{
+                    static_cast<std::int64_t>(
+                        std::floor(vector.x / this->cellSize)
+                    ),
+                    static_cast<std::int64_t>(
+                        std::floor(vector.y / this->cellSize)
+                    ),
+                    static_cast<std::int64_t>(
+                        std::floor(vector.z / this->cellSize)
+                    )
+                };
+            }
+
+            double marginInCell(const Vector vector, const Cell cell) const{
+                const auto margin = [&](
+                    const double coordinate,
+                    const std::int64_t index
+                ){
+                    const double offset = coordinate - index * this->cellSize;
+
+                    return std::min(offset, this->cellSize - offset);
+                };
+
+                return std::max(
+                    0.,
+                    std::min(
+                        margin(vector.x, cell.x),
+                        std::min(
+                            margin(vector.y, cell.y),
+                            margin(vector.z, cell.z)
+                        )
+                    )
+                );
+            }
+
+            template<typename Function>
+            void visitCell(const Cell cell, const Function &function) const{
+                const auto found = this->cells.find(cell);
+
+                if(found != this->cells.end()){
+                    function(found->second);
+                }
+            }
+
+            template<typename Function>
+            void forEachCellOfRing(
+                const Cell center,
+                const std::int64_t ring,
+                const Function &function
+            ) const{
+                for(std::int64_t x = -ring; x <= ring; ++x){
+                    for(std::int64_t y = -ring; y <= ring; ++y){
+                        const bool itIsOnSide = std::abs(x) == ring
+                            || std::abs(y) == ring;
+                        const std::int64_t step = itIsOnSide || ring == 0
+                            ? 1
+                            : 2 * ring;
+
+                        for(std::int64_t z = -ring; z <= ring; z += step){
+                            this->visitCell(
+                                Cell{center.x + x, center.y + y, center.z + z},
+                                function
+                            );
+                        }
+                    }
+                }
+            }
+
+            std::vector<conn::WaypointMatch> matchesFrom(
+                const std::vector< std::pair<double, std::size_t> > &found
+            ) const{
+                std::vector<conn::WaypointMatch> matches;
+
+                matches.reserve(found.size());
+
+                for(const auto &candidate : found){
+                    matches.push_back(
+                        conn::WaypointMatch{
+                            candidate.second,
+                            this->distanceOfChord(candidate.first)
+                        }
+                    );
+                }
+
+                return matches;
+            }
+
+            double distanceOfChord(const double squaredChord) const{
+                return 2. * this->radius * asin(
+                    std::min(1., 0.5 * sqrt(squaredChord))
+                );
+            }
+
+            double radius;
+            double cellSize;
+            std::vector<conn::GeoPoint> points;
+            std::vector<Vector> vectors;
+            std::unordered_map<Cell, std::vector<std::size_t>, CellHash> cells;
+    };
+
+    /// \} End of IndexFunctions Group
+
+    /// \defgroup GeofenceFunctions Geofence Functions
+    /// \brief Classes testing points against polygons
+    /// \details Group of classes that check waypoints against exclusion 
+    /// zones given as polygons in geographic coordinates. A polygon is 
+    /// projected once to a local plane around the center of its bounds, 
+    /// where its edges are straight lines, so queries take no trigonometry. 
+    /// The projection is equirectangular, it suits fences up to tens of 
+    /// kilometers away from the poles: distances are off by about the 
+    /// relative change of the cosine of latitude across the fence
+    /// \{
+
+    /// \class Geofence
+    /// \brief Polygon with precomputed edges
+    /// \details Keeps the edges of a polygon in a local plane together with 
+    /// two indexes: horizontal bands listing the edges that cross them, for 
+    /// the crossing number test, and a tree of bounding boxes of runs of 
+    /// edges, for distances to the boundary. Points inside holes of a 
+    /// self-overlapping polygon are outside by the even-odd rule. The 
+    /// polygon is closed implicitly and may cross the antimeridian
+    class Geofence{
+        public:
+            /// \brief Creates a geofence
+            /// \param vertices Vertices of the polygon (in degrees), the 
+            /// last one is joined to the first one
+            /// \param radius Optional. Earth radius. Average radius by 
+            /// default
+            /// \exception std::runtime_error If there are less than 3 
+            /// vertices
+            explicit Geofence(
+                const std::vector<conn::GeoPoint> &vertices,
+                const double radius = conn::earthRadius
+            ) : vertices(vertices), radius(radius){
+                if(vertices.size() < 3){
+                    throw std::runtime_error(
+                        "Geofence needs at least 3 vertices"
+                    );
+                }
+
+                this->calculateFrame();
+                this->calculateBands();
+                this->calculateTree();
+            }
+
+            /// \brief Gets a number of vertices
+            /// \return Number of vertices
+            std::size_t getNumberOfVertices() const{
+                return this->vertices.size();
+            }
+
+            /// \brief Gets a vertex
+            /// \param index Index of the vertex
+            /// \return Vertex (in degrees)
+            conn::GeoPoint getVertex(const std::size_t index) const{
+                return this->vertices[index];
+            }
+
+            /// \brief Gets the Earth radius of the fence
+            /// \return Radius in meters used to project the polygon
+            double getRadius() const{
+                return this->radius;
+            }
+
+            /// \brief Gets the southwest corner of the bounds
+            /// \return Smallest latitude and longitude (in degrees), the 
+            /// longitude is less than the longitude of getNorthEast()
+            conn::GeoPoint getSouthWest() const{
+                return conn::GeoPoint{
+                    this->minimumLatitude,
+                    this->centerLongitude + this->minimumLongitudeOffset
+                };
+            }
+
+            /// \brief Gets the northeast corner of the bounds
+            /// \return Largest latitude and longitude (in degrees), the 
+            /// longitude may be above 180 degrees for fences crossing the 
+            /// antimeridian
+            conn::GeoPoint getNorthEast() const{
+                return conn::GeoPoint{
+                    this->maximumLatitude,
+                    this->centerLongitude + this->maximumLongitudeOffset
+                };
+            }
+
+            /// \brief Checks if a point is inside the fence
+            /// \param point Point to check (in degrees)
+            /// \return True if the point is inside
+            bool contains(const conn::GeoPoint point) const{
+                if(
+                    point.latitude < this->minimumLatitude
+                    || this->maximumLatitude < point.latitude
+                ){
+                    return false;
+                }
+
+                const double offset = conn::longitudeDifference(
+                    this->centerLongitude,
+                    point.longitude
+                );
+
+                if(
+                    offset < this->minimumLongitudeOffset
+                    || this->maximumLongitudeOffset < offset
+                ){
+                    return false;
+                }
+
+                const conn::LocalPoint local{
+                    this->scaleX * offset,
+                    this->scaleY * (point.latitude - this->centerLatitude)
+                };
+                const std::size_t band = this->bandOf(local.y);
+
+                bool itIsInside = false;
+
+                for(
+                    std::size_t i = this->bandStarts[band];
+                    i < this->bandStarts[band + 1];
+                    ++i
+                ){
+                    const Edge &edge = this->edges[this->bandEdges[i]];
+
+                    if(
+                        (local.y < edge.start.y) != (local.y < edge.finish.y)
+                        && local.x < edge.start.x
+                            + (local.y - edge.start.y) * edge.slope
+                    ){
+                        itIsInside = !itIsInside;
+                    }
+                }
+
+                return itIsInside;
+            }
+
+            /// \brief Checks if points are inside the fence
+            /// \param latitudes Latitudes of the points (in degrees)
+            /// \param longitudes Longitudes of the points (in degrees)
+            /// \param numberOfPoints Number of points
+            /// \param results Buffer for flags, nonzero if the point is 
+            /// inside
+            void contains(
+                const double *latitudes,
+                const double *longitudes,
+                const std::size_t numberOfPoints,
+                char *results
+            ) const{
+                for(std::size_t i = 0; i < numberOfPoints; ++i){
+                    results[i] = this->contains(
+                        conn::GeoPoint{latitudes[i], longitudes[i]}
+                    );
+                }
+            }
+
+            /// \brief Calculates distance to the boundary
+            /// \param point Point to measure from (in degrees)
+            /// \return Distance to the nearest edge in meters, whether the 
+            /// point is inside or not
+            double distanceToBoundary(const conn::GeoPoint point) const{
+                const conn::LocalPoint local{
+                    this->scaleX * conn::longitudeDifference(
+                        this->centerLongitude,
+                        point.longitude
+                    ),
+                    this->scaleY * (point.latitude - this->centerLatitude)
+                };
+
+                double best = HUGE_VAL;
+                std::size_t stack[64];
+                std::size_t depth = 0;
+
+                stack[depth++] = 0;
+
+                while(depth > 0){
+                    const Node &node = this->nodes[stack[--depth]];
+
+                    if(best <= node.box.distanceTo(local)){
+                        continue;
+                    }
+
+                    if(node.numberOfEdges > 0){
+                        for(
+                            std::size_t i = node.firstEdge;
+                            i < node.firstEdge + node.numberOfEdges;
+                            ++i
+                        ){
+                            best = std::min(
+                                best,
+                                conn::distanceToSegment(
+                                    local,
+                                    this->edges[i].start,
+                                    this->edges[i].finish
+                                )
+                            );
+                        }
+                    }else{
+                        stack[depth++] = node.secondChild;
+                        stack[depth++] = node.firstChild;
+                    }
+                }
+
+                return best;
+            }
+
+            /// \brief Calculates distances to the boundary
+            /// \param latitudes Latitudes of the points (in degrees)
+            /// \param longitudes Longitudes of the points (in degrees)
+            /// \param numberOfPoints Number of points
+            /// \param distances Buffer for distances in meters
+            void distancesToBoundary(
+                const double *latitudes,
+                const double *longitudes,
+                const std::size_t numberOfPoints,
+                double *distances
+            ) const{
+                for(std::size_t i = 0; i < numberOfPoints; ++i){
+                    distances[i] = this->distanceToBoundary(
+                        conn::GeoPoint{latitudes[i], longitudes[i]}
+                    );
+                }
+            }
+
+        private:
+            struct Box{
+                double minimumX;
+                double minimumY;
+                double maximumX;
+                double maximumY;
+
+                void add(const conn::LocalPoint point){
+                    this->minimumX = std::min(this->minimumX, point.x);
+                    this->minimumY = std::min(this->minimumY, point.y);
+                    this->maximumX = std::max(this->maximumX, point.x);
+                    this->maximumY = std::max(this->maximumY, point.y);
+                }
+
+                double distanceTo(const conn::LocalPoint point) const{
+                    const double x = std::max(
+                        0.,
+                        std::max(
+                            this->minimumX - point.x,
+                            point.x - this->maximumX
+                        )
+                    );
+                    const double y = std::max(
+                        0.,
+                        std::max(
+                            this->minimumY - point.y,
+                            point.y - this->maximumY
+                        )
+                    );
+
+                    return sqrt(x * x + y * y);
+                }
+            };
+
+            struct Edge{
+                conn::LocalPoint start;
+                conn::LocalPoint finish;
+                double slope;
+            };
+
+            struct Node{
+                Box box;
+                std::size_t firstEdge;
+                std::size_t numberOfEdges;
+                std::size_t firstChild;
+                std::size_t secondChild;
+            };
+
+            static constexpr std::size_t edgesPerLeaf = 8;
+
+            void calculateFrame(){
+                double minimumOffset = 0.;
+                double maximumOffset = 0.;
+
+                this->minimumLatitude = this->vertices[0].latitude;
+                this->maximumLatitude = this->vertices[0].latitude;
+
+                for(const conn::GeoPoint vertex : this->vertices){
+                    const double offset = conn::longitudeDifference(
+                        this->vertices[0].longitude,
+                        vertex.longitude
+                    );
+
+                    minimumOffset = std::min(minimumOffset, offset);
+                    maximumOffset = std::max(maximumOffset, offset);
+                    this->minimumLatitude = std::min(
+                        this->minimumLatitude,
+                        vertex.latitude
+                    );
+                    this->maximumLatitude = std::max(
+                        this->maximumLatitude,
+                        vertex.latitude
+                    );
+                }
+
+                const double halfWidth = 0.5 * (maximumOffset - minimumOffset);
+
+                this->centerLatitude = 0.5 * (
+                    this->minimumLatitude + this->maximumLatitude
+                );
+                this->centerLongitude = this->vertices[0].longitude
+                    + 0.5 * (minimumOffset + maximumOffset);
+                this->minimumLongitudeOffset = -halfWidth;
+                this->maximumLongitudeOffset = halfWidth;
+                this->scaleY = conn::radiansFromDegrees(this->radius);
+                this->scaleX = this->scaleY * cos(
+                    conn::radiansFromDegrees(this->centerLatitude)
+                );
+
+                const std::size_t numberOfVertices = this->vertices.size();
+
+                this->edges.resize(numberOfVertices);
+
+                for(std::size_t i = 0; i < numberOfVertices; ++i){
+                    this->edges[i].start = this->localPointOf(
+                        this->vertices[i]
+                    );
+                }
+
+                for(std::size_t i = 0; i < numberOfVertices; ++i){
+                    Edge &edge = this->edges[i];
+
+                    edge.finish = this->edges[
+                        (i + 1) % numberOfVertices
+                    ].start;
+                    edge.slope = edge.finish.y == edge.start.y
+                        ? 0.
+                        : (edge.finish.x - edge.start.x)
+                            / (edge.finish.y - edge.start.y);
+                }
+            }
+
+            conn::LocalPoint localPointOf(const conn::GeoPoint point) const{
+                return conn::LocalPoint{
+                    this->scaleX * conn::longitudeDifference(
+                        this->centerLongitude,
+                        point.longitude
+                    ),
+                    this->scaleY * (point.latitude - this->centerLatitude)
+                };
+            }
+
+            std::size_t bandOf(const double y) const{
+                const double band = (y - this->bandOrigin) * this->bandScale;
+
+                if(band <= 0.){
+                    return 0;
+                }
+
+                return std::min(
+                    static_cast<std::size_t>(band),
+                    this->bandStarts.size() - 2
+                );
+            }
+
+            void calculateBands(){
+                const std::size_t numberOfBands = std::max<std::size_t>(
+                    1,
+                    this->edges.size() / 2
+                );
+
+                Box box = Box{HUGE_VAL, HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+                for(const Edge &edge : this->edges){
+                    box.add(edge.start);
+                }
+
+                this->bandOrigin = box.minimumY;
+                this->bandScale = box.maximumY > box.minimumY
+                    ? numberOfBands / (box.maximumY - box.minimumY)
+                    : 0.;
+                this->bandStarts.assign(numberOfBands + 1, 0);
+
+                const auto forEachBand = [&](
+                    const Edge &edge,
+                    const std::function<void(std::size_t)> &function
+                ){
+                    const std::size_t first = this->bandOf(
+                        std::min(edge.start.y, edge.finish.y)
+                    );
+                    const std::size_t last = this->bandOf(
+                        std::max(edge.start.y, edge.finish.y)
+                    );
+
+                    for(std::size_t band = first; band <= last; ++band){
+                        function(band);
+                    }
+                };
+
+                for(const Edge &edge : this->edges){
+                    forEachBand(edge, [&](const std::size_t band){
+                        ++this->bandStarts[band + 1];
+                    });
+                }
+
+                for(std::size_t band = 0; band < numberOfBands; ++band){
+                    this->bandStarts[band + 1] += this->bandStarts[band];
+                }
+
+                std::vector<std::size_t> next(
+                    this->bandStarts.begin(),
+                    this->bandStarts.end() - 1
+                );
+
+                this->bandEdges.resize(this->bandStarts.back());
+
+                for(std::size_t i = 0; i < this->edges.size(); ++i){
+                    forEachBand(this->edges[i], [&](const std::size_t band){
+                        this->bandEdges[next[band]++] = i;
+                    });
+                }
+            }
+
+            std::size_t calculateNode(
+                const std::size_t firstEdge,
+                const std::size_t numberOfEdges
+            ){
+                const std::size_t index = this->nodes.size();
+
+                Box box = Box{HUGE_VAL, HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+                for(std::size_t i = 0; i < numberOfEdges; ++i){
+                    box.add(this->edges[firstEdge + i].start);
+                    box.add(this->edges[firstEdge + i].finish);
+                }
+
+                this->nodes.push_back(
+                    Node{box, firstEdge, numberOfEdges, 0, 0}
+                );
+
+                if(numberOfEdges > edgesPerLeaf){
+                    const std::size_t half = numberOfEdges / 2;
+                    const std::size_t first = this->calculateNode(
+                        firstEdge,
+                        half
+                    );
+                    const std::size_t second = this->calculateNode(
+                        firstEdge + half,
+                        numberOfEdges - half
+                    );
+
+                    this->nodes[index].numberOfEdges = 0;
+                    this->nodes[index].firstChild = first;
+                    this->nodes[index].secondChild = second;
+                }
+
+                return index;
+            }
+
+            void calculateTree(){
+                this->nodes.clear();
+                this->calculateNode(0, this->edges.size());
+            }
+
+            std::vector<conn::GeoPoint> vertices;
+            double radius;
+            double minimumLatitude;
+            double maximumLatitude;
+            double minimumLongitudeOffset;
+            double maximumLongitudeOffset;
+            double centerLatitude;
+            double centerLongitude;
+            double scaleX;
+            double scaleY;
+            std::vector<Edge> edges;
+            double bandOrigin;
+            double bandScale;
+            std::vector<std::size_t> bandStarts;
+            std::vector<std::size_t> bandEdges;
+            std::vector<Node> nodes;
+    };
+
+    /// \class GeofenceSet
+    /// \brief Set of geofences
+    /// \details Buckets geofences by their bounds in a grid of latitude and 
+    /// longitude cells, so a point is checked only against the fences whose 
+    /// bounds cover its cell. Consecutive points of a path usually fall in 
+    /// the same cell, which batch queries look up once. Fences covering more 
+    /// than maximumCellsPerFence cells are checked for every point
+    class GeofenceSet{
+        public:
+            /// \brief Largest number of cells a fence is bucketed in
+            static constexpr std::size_t maximumCellsPerFence = 4096;
+
+            /// \brief Creates an empty set
+            /// \param cellSize Optional. Size of a cell in degrees. 0.1 by 
+            /// default
+            explicit GeofenceSet(const double cellSize = 0.1)
+                : cellSize(cellSize),
+                numberOfLongitudeCells(
+                    std::max<std::int64_t>(
+                        1,
+                        static_cast<std::int64_t>(std::ceil(360. / cellSize))
+                    )
+                ),
+                smallestRadius(conn::earthRadius){
+            }
+
+            /// \brief Gets a number of fences
+            /// \return Number of fences
+            std::size_t size() const{
+                return this->fences.size();
+            }
+
+            /// \brief Gets a fence
+            /// \param index Index of the fence
+            /// \return Fence
+            const conn::Geofence &operator[](const std::size_t index) const{
+                return this->fences[index];
+            }
+
+            /// \brief Adds a fence
+            /// \param fence Fence to add
+            /// \return Index of the fence
+            std::size_t insert(const conn::Geofence &fence){
+                const std::size_t index = this->fences.size();
+                const conn::GeoPoint southWest = fence.getSouthWest();
+                const conn::GeoPoint northEast = fence.getNorthEast();
+                const std::int64_t firstRow = this->rowOf(southWest.latitude);
+                const std::int64_t lastRow = this->rowOf(northEast.latitude);
+                const std::int64_t firstColumn = static_cast<std::int64_t>(
+                    std::floor((southWest.longitude + 180.) / this->cellSize)
+                );
+                const std::int64_t lastColumn = static_cast<std::int64_t>(
+                    std::floor((northEast.longitude + 180.) / this->cellSize)
+                );
+                const std::int64_t numberOfColumns = std::min(
+                    lastColumn - firstColumn + 1,
+                    this->numberOfLongitudeCells
+                );
+
+                this->fences.push_back(fence);
+                this->smallestRadius = 0 == index
+                    ? fence.getRadius()
+                    : std::min(this->smallestRadius, fence.getRadius());
+                this->cellRanges.push_back(
+                    CellRange{firstRow, lastRow, firstColumn, numberOfColumns}
+                );
+
+                if(
+                    static_cast<double>(lastRow - firstRow + 1)
+                        * numberOfColumns
+                    > maximumCellsPerFence
+                ){
+                    this->unbucketedFences.push_back(index);
+
+                    return index;
+                }
+
+                for(std::int64_t row = firstRow; row <= lastRow; ++row){
+                    for(
+                        std::int64_t column = firstColumn;
+                        column < firstColumn + numberOfColumns;
+                        ++column
+                    ){
+                        this->cells[this->keyOf(row, column)].push_back(index);
+                    }
+                }
+
+                return index;
+            }
+
+            /// \brief Adds a fence
+            /// \param vertices Vertices of the polygon (in degrees)
+            /// \param radius Optional. Earth radius. Average radius by 
+            /// default
+            /// \return Index of the fence
+            /// \exception std::runtime_error If there are less than 3 
+            /// vertices
+            std::size_t insert(
+                const std::vector<conn::GeoPoint> &vertices,
+                const double radius = conn::earthRadius
+            ){
+                return this->insert(conn::Geofence(vertices, radius));
+            }
+
+            /// \brief Calls a function for fences containing a point
+            /// \param point Point to check (in degrees)
+            /// \param function Function taking an index of a fence
+            template<typename Function>
+            void forEachContaining(
+                const conn::GeoPoint point,
+                const Function &function
+            ) const{
+                const std::vector<std::size_t> *bucket = this->bucketOf(point);
+
+                if(bucket != nullptr){
+                    for(const std::size_t index : *bucket){
+                        if(this->fences[index].contains(point)){
+                            function(index);
+                        }
+                    }
+                }
+
+                for(const std::size_t index : this->unbucketedFences){
+                    if(this->fences[index].contains(point)){
+                        function(index);
+                    }
+                }
+            }
+
+            /// \brief Finds a fence containing a point
+            /// \param point Point to check (in degrees)
+            /// \return Smallest index of a fence containing the point, size() 
+            /// if there is no such fence
+            std::size_t firstContaining(const conn::GeoPoint point) const{
+                return this->firstContaining(point, this->bucketOf(point));
+            }
+
+            /// \brief Finds fences containing points
+            /// \details Finds the smallest index of a fence containing each 
+            /// point, or size() if there is no such fence
+            /// \param latitudes Latitudes of the points (in degrees)
+            /// \param longitudes Longitudes of the points (in degrees)
+            /// \param numberOfPoints Number of points
+            /// \param results Buffer for indexes of the fences
+            /// \return Number of points inside some fence
+            std::size_t firstContaining(
+                const double *latitudes,
+                const double *longitudes,
+                const std::size_t numberOfPoints,
+                std::size_t *results
+            ) const{
+                std::size_t numberOfInsidePoints = 0;
+                std::uint64_t lastKey = 0;
+                const std::vector<std::size_t> *bucket = nullptr;
+
+                for(std::size_t i = 0; i < numberOfPoints; ++i){
+                    const conn::GeoPoint point{latitudes[i], longitudes[i]};
+                    const std::uint64_t key = this->keyOf(point);
+
+                    if(i == 0 || key != lastKey){
+                        bucket = this->bucketOf(key);
+                        lastKey = key;
+                    }
+
+                    results[i] = this->firstContaining(point, bucket);
+
+                    if(results[i] < this->fences.size()){
+                        ++numberOfInsidePoints;
+                    }
+                }
+
+                return numberOfInsidePoints;
+            }
+
+            /// \brief Calculates distance to the nearest fence boundary
+            /// \details Visits only the cells within the distance limit of 
+            /// the point and checks each fence found there once, if its 
+            /// bounds are within the limit too. Fences that are not bucketed 
+            /// are checked by their bounds, and so are all fences if the 
+            /// limit covers more than maximumCellsPerFence cells. The limit 
+            /// is turned into degrees with the smallest radius of the fences, 
+            /// which gives the widest margin
+            /// \param point Point to measure from (in degrees)
+            /// \param maximumDistance Distance limit in meters
+            /// \return Distance in meters, or \p maximumDistance if no 
+            /// boundary is closer
+            double distanceToBoundary(
+                const conn::GeoPoint point,
+                const double maximumDistance
+            ) const{
+                const double latitudeMargin = conn::degreesFromRadians(
+                    maximumDistance / this->smallestRadius
+                );
+                const double longitudeMargin = latitudeMargin / cos(
+                    conn::radiansFromDegrees(
+                        std::min(
+                            89.,
+                            std::fabs(point.latitude) + latitudeMargin
+                        )
+                    )
+                );
+                const std::int64_t firstRow = this->rowOf(
+                    std::max(-90., point.latitude - latitudeMargin)
+                );
+                const std::int64_t lastRow = this->rowOf(
+                    std::min(90., point.latitude + latitudeMargin)
+                );
+                const std::int64_t firstColumn = this->columnOf(
+                    point.longitude - longitudeMargin
+                );
+                const std::int64_t numberOfColumns = std::min(
+                    this->columnOf(point.longitude + longitudeMargin)
+                        - firstColumn + 1,
+                    this->numberOfLongitudeCells
+                );
+
+                double best = maximumDistance;
+
+                if(
+                    static_cast<double>(lastRow - firstRow + 1)
+                        * numberOfColumns
+                    > maximumCellsPerFence
+                ){
+                    for(std::size_t i = 0; i < this->fences.size(); ++i){
+                        best = this->distanceToFence(
+                            i,
+                            point,
+                            latitudeMargin,
+                            longitudeMargin,
+                            best
+                        );
+                    }
+
+                    return best;
+                }
+
+                for(std::int64_t row = firstRow; row <= lastRow; ++row){
+                    for(
+                        std::int64_t column = 0;
+                        column < numberOfColumns;
+                        ++column
+                    ){
+                        const std::vector<std::size_t> *bucket =
+                            this->bucketOf(
+                                this->keyOf(row, firstColumn + column)
+                            );
+
+                        if(bucket == nullptr){
+                            continue;
+                        }
+
+                        for(const std::size_t index : *bucket){
+                            if(
+                                this->isFirstCellOf(
+                                    index,
+                                    row,
+                                    column,
+                                    firstRow,
+                                    firstColumn
+                                )
+                            ){
+                                best = this->distanceToFence(
+                                    index,
+                                    point,
+                                    latitudeMargin,
+                                    longitudeMargin,
+                                    best
+                                );
+                            }
+                        }
+                    }
+                }
+
+                for(const std::size_t index : this->unbucketedFences){
+                    best = this->distanceToFence(
+                        index,
+                        point,
+                        latitudeMargin,
+                        longitudeMargin,
+                        best
+                    );
+                }
+
+                return best;
+            }
+
+            /// \brief Calculates distances to the nearest fence boundaries
+            /// \details Calculates distance to the nearest fence boundary for 
+            /// each point, see distanceToBoundary()
+            /// \param latitudes Latitudes of the points (in degrees)
+            /// \param longitudes Longitudes of the points (in degrees)
+            /// \param numberOfPoints Number of points
+            /// \param maximumDistance Distance limit in meters
+            /// \param distances Buffer for distances in meters, \p 
+            /// maximumDistance where no boundary is closer
+            void distancesToBoundary(
+                const double *latitudes,
+                const double *longitudes,
+                const std::size_t numberOfPoints,
+                const double maximumDistance,
+                double *distances
+            ) const{
+                for(std::size_t i = 0; i < numberOfPoints; ++i){
+                    distances[i] = this->distanceToBoundary(
+                        conn::GeoPoint{latitudes[i], longitudes[i]},
+                        maximumDistance
+                    );
+                }
+            }
+
+        private:
+            struct CellRange{
+                std::int64_t firstRow;
+                std::int64_t lastRow;
+                std::int64_t firstColumn;
+                std::int64_t numberOfColumns;
+            };
+
+            std::int64_t rowOf(const double latitude) const{
+                return static_cast<std::int64_t>(
+                    std::floor((latitude + 90.) / this->cellSize)
+                );
+            }
+
+            std::int64_t columnOf(const double longitude) const{
+                return static_cast<std::int64_t>(
+                    std::floor((longitude + 180.) / this->cellSize)
+                );
+            }
+
+            bool isFirstCellOf(
+                const std::size_t index,
+                const std::int64_t row,
+                const std::int64_t column,
+                const std::int64_t firstRow,
+                const std::int64_t firstColumn
+            ) const{
+                const CellRange &range = this->cellRanges[index];
+
+                if(row != std::max(range.firstRow, firstRow)){
+                    return false;
+                }
+
+                std::int64_t shift = (firstColumn - range.firstColumn)
+                    % this->numberOfLongitudeCells;
+
+                if(shift < 0){
+                    shift += this->numberOfLongitudeCells;
+                }
+
+                if(shift < range.numberOfColumns){
+                    return 0 == column;
+                }
+
+                return column == this->numberOfLongitudeCells - shift;
+            }
+
+            double distanceToFence(
+                const std::size_t index,
+                const conn::GeoPoint point,
+                const double latitudeMargin,
+                const double longitudeMargin,
+                const double best
+            ) const{
+                const conn::Geofence &fence = this->fences[index];
+                const conn::GeoPoint southWest = fence.getSouthWest();
+                const conn::GeoPoint northEast = fence.getNorthEast();
+                const double halfWidth = 0.5 * (
+                    northEast.longitude - southWest.longitude
+                );
+                const double offset = conn::longitudeDifference(
+                    southWest.longitude + halfWidth,
+                    point.longitude
+                );
+
+                if(
+                    point.latitude < southWest.latitude - latitudeMargin
+                    || northEast.latitude + latitudeMargin < point.latitude
+                    || halfWidth + longitudeMargin < std::fabs(offset)
+                ){
+                    return best;
+                }
+
+                return std::min(best, fence.distanceToBoundary(point));
+            }
+
+            std::uint64_t keyOf(
+                const std::int64_t row,
+                const std::int64_t column
+            ) const{
+                std::int64_t wrapped = column % this->numberOfLongitudeCells;
+
+                if(wrapped < 0){
+                    wrapped += this->numberOfLongitudeCells;
+                }
+
+                return static_cast<std::uint64_t>(row)
+                    * static_cast<std::uint64_t>(this->numberOfLongitudeCells)
+                    + static_cast<std::uint64_t>(wrapped);
+            }
+
+            std::uint64_t keyOf(const conn::GeoPoint point) const{
+                return this->keyOf(
+                    this->rowOf(point.latitude),
+                    this->columnOf(point.longitude)
+                );
+            }
+
+            const std::vector<std::size_t> *bucketOf(
+                const std::uint64_t key
+            ) const{
+                const auto found = this->cells.find(key);
+
+                return found == this->cells.end() ? nullptr : &found->second;
+            }
+
+            const std::vector<std::size_t> *bucketOf(
+                const conn::GeoPoint point
+            ) const{
+                return this->bucketOf(this->keyOf(point));
+            }
+
+            std::size_t firstContaining(
+                const conn::GeoPoint point,
+                const std::vector<std::size_t> *bucket
+            ) const{
+                std::size_t first = this->fences.size();
+
+                if(bucket != nullptr){
+                    for(const std::size_t index : *bucket){
+                        if(this->fences[index].contains(point)){
+                            first = index;
+                            break;
+                        }
+                    }
+                }
+
+                for(const std::size_t index : this->unbucketedFences){
+                    if(first <= index){
+                        break;
+                    }
+
+                    if(this->fences[index].contains(point)){
+                        first = index;
+                        break;
+                    }
+                }
+
+                return first;
+            }
+
+            double cellSize;
+            std::int64_t numberOfLongitudeCells;
+            double smallestRadius;
+            std::vector<conn::Geofence> fences;
+            std::vector<CellRange> cellRanges;
+            std::vector<std::size_t> unbucketedFences;
+            std::unordered_map<
+                std::uint64_t,
+                std::vector<std::size_t>
+            > cells;
+    };
+
+    /// \} End of GeofenceFunctions Group
+
+    #if defined(CONN_EXTERN_TEMPLATES)
+    extern template conn::BasicLocalPoint<double> segmentPointAt<double>(
+        const conn::Segment &,
+        const double
+    );
+    extern template std::size_t fillPoints<double>(
+        const conn::Path &,
+        conn::BasicLocalPoint<double> *
+    );
+    extern template std::size_t projectPath<double>(
+        const conn::Path &,
+        const conn::BasicGeoPoint<double>,
+        double *,
+        double *,
+        const std::size_t,
+        const bool
+    );
+    extern template std::size_t projectPath<double>(
+        const conn::Path &,
+        const conn::BasicLocalFrame<double> &,
+        double *,
+        double *,
+        const std::size_t
+    );
+    extern template std::size_t fillPoints<double>(
+        const conn::TransformedPath &,
+        conn::BasicLocalPoint<double> *
+    );
+    extern template std::size_t projectPath<double>(
+        const conn::TransformedPath &,
+        const conn::BasicGeoPoint<double>,
+        double *,
+        double *,
+        const std::size_t,
+        const bool
+    );
+    extern template std::size_t projectPath<double>(
+        const conn::TransformedPath &,
+        const conn::BasicLocalFrame<double> &,
+        double *,
+        double *,
+        const std::size_t
+    );
+
+    extern template conn::BasicLocalPoint<float> segmentPointAt<float>(
+        const conn::Segment &,
+        const float
+    );
+    extern template std::size_t fillPoints<float>(
+        const conn::Path &,
+        conn::BasicLocalPoint<float> *
+    );
+    extern template std::size_t projectPath<float>(
+        const conn::Path &,
+        const conn::BasicGeoPoint<float>,
+        float *,
+        float *,
+        const std::size_t,
+        const bool
+    );
+    extern template std::size_t projectPath<float>(
+        const conn::Path &,
+        const conn::BasicLocalFrame<float> &,
+        float *,
+        float *,
+        const std::size_t
+    );
+    extern template std::size_t fillPoints<float>(
+        const conn::TransformedPath &,
+        conn::BasicLocalPoint<float> *
+    );
+    extern template std::size_t projectPath<float>(
+        const conn::TransformedPath &,
+        const conn::BasicGeoPoint<float>,
+        float *,
+        float *,
+        const std::size_t,
+        const bool
+    );
+    extern template std::size_t projectPath<float>(
+        const conn::TransformedPath &,
+        const conn::BasicLocalFrame<float> &,
+        float *,
+        float *,
+        const std::size_t
+    );
+    #endif
+}
+
+/// \} End of Main Group
+
+#endif
@@ -24,27 +24,41 @@ int main(const int argc, const char *argv[]){
     initialGPSPoint.push_back(std::vector<double>{41., 59., 04.});
     initialGPSPoint.push_back(std::vector<double>{02., 49., 16.});
     conn::printGPSPoint(initialGPSPoint);
-    std::vector< std::vector<double> > nextGPSPoint;
     const double latitude = conn::degreesFromGPSCoordinate(
         initialGPSPoint[0]
     );
     const double longitude = conn::degreesFromGPSCoordinate(
         initialGPSPoint[1]
     );
+    std::vector<double> distances(relativePoints.size() - 1);
+    std::vector<double> bearings(relativePoints.size() - 1);
     for(std::size_t i = 1; i < relativePoints.size(); ++i){
-        const double destination = sqrt(
+        distances[i - 1] = sqrt(
             std::pow(points[i][0], 2) 
             + std::pow(points[i][1], 2)
         );
-        const double bearing = asin(points[i][0] / destination);
-        nextGPSPoint = conn::destinationGPSPoint(
-            latitude,
-            longitude,
-            destination,
-            bearing,
-            false
+        bearings[i - 1] = conn::degreesFromRadians(
+            atan2(points[i][0], points[i][1])
+        );
+    }
+    
+    std::vector<double> latitudes(distances.size());
+    std::vector<double> longitudes(distances.size());
+    conn::destinations(
+        conn::GeoPoint{latitude, longitude},
+        distances.data(),
+        bearings.data(),
+        distances.size(),
+        latitudes.data(),
+        longitudes.data(),
+        false
+    );
+    for(std::size_t i = 0; i < distances.size(); ++i){
+        conn::printGPSPoint(
+            conn::gpsPointFromDegrees(
+                conn::GeoPoint{latitudes[i], longitudes[i]}
+            )
         );
-        conn::printGPSPoint(nextGPSPoint);
     }
     
     return 0;